@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Arm Limited. All rights reserved.
+ * Copyright (c) 2018-2026 Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -15,11 +15,30 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *
- * $Date:        27. January 2020
- * $Revision:    V1.2.0
+ * $Date:        18. October 2026
+ * $Revision:    V1.3.0
  *
  * Project:      IoT Socket API definitions
  *
+ * Version 1.3.0
+ *   Added function iotSocketGetAddrInfo
+ *   Added socket options TCP_NODELAY and TCP_CORK
+ *   Added socket options SO_RCVBUF, SO_SNDBUF and TCP_WINDOW
+ *   Added socket options TCP_KEEPIDLE, TCP_KEEPINTVL and TCP_KEEPCNT
+ *   Added socket options for multicast (IP_ADD_MEMBERSHIP, IP_DROP_MEMBERSHIP,
+ *     IP_MULTICAST_TTL, IP_MULTICAST_LOOP and IPv6 equivalents)
+ *   Added socket option SO_BROADCAST
+ *   Added function iotSocketGetBroadcastAddr
+ *   Added socket options IP_TOS and SO_PRIORITY
+ *   Added function iotSocketShutdown
+ *   Added socket option SO_LINGER
+ *   Added socket option SO_REUSEADDR
+ *   Added support for port 0 (ephemeral port) in iotSocketBind
+ *   Added functions iotSocketRecvEx and iotSocketSendEx (message flags)
+ *   Added socket option IO_FIONREAD
+ *   Added functions iotSocketAcceptTimed, iotSocketConnectTimed, iotSocketRecvTimed and iotSocketSendTimed
+ *   Added socket options SO_TIMESTAMP and SO_TIMESTAMP_TX
+ *   Added function iotSocketRecvFromTs
  * Version 1.2.0
  *   Extended iotSocketRecv/RecvFrom/Send/SendTo (support for polling)
  * Version 1.1.0
@@ -48,6 +67,7 @@ extern "C"
 
 
 /**** Address Family definitions ****/
+#define IOT_SOCKET_AF_UNSPEC            0       ///< Unspecified (any address family, iotSocketGetAddrInfo only)
 #define IOT_SOCKET_AF_INET              1       ///< IPv4
 #define IOT_SOCKET_AF_INET6             2       ///< IPv6
 
@@ -59,12 +79,51 @@ extern "C"
 #define IOT_SOCKET_IPPROTO_TCP          1       ///< TCP
 #define IOT_SOCKET_IPPROTO_UDP          2       ///< UDP
 
+/**** Socket Shutdown definitions ****/
+#define IOT_SOCKET_SHUT_RD              0       ///< Disable further receive operations
+#define IOT_SOCKET_SHUT_WR              1       ///< Disable further send operations
+#define IOT_SOCKET_SHUT_RDWR            2       ///< Disable further send and receive operations
+
+/**** Socket Message Flags definitions ****/
+#define IOT_SOCKET_MSG_PEEK             0x01U   ///< Return data without removing it from the receive queue
+#define IOT_SOCKET_MSG_DONTWAIT         0x02U   ///< Do not block for this call (non-blocking operation)
+#define IOT_SOCKET_MSG_WAITALL          0x04U   ///< Wait until the buffer is full, the connection closes or an error occurs
+#define IOT_SOCKET_MSG_TRUNC            0x08U   ///< Return the real length of a datagram, even when it was truncated
+
+/**** Socket Timestamp Flags definitions ****/
+#define IOT_SOCKET_TIMESTAMP_RX         0x01U   ///< Timestamp received datagrams
+#define IOT_SOCKET_TIMESTAMP_TX         0x02U   ///< Timestamp sent datagrams
+
 /**** Socket Option definitions ****/
 #define IOT_SOCKET_IO_FIONBIO           1       ///< Non-blocking I/O (Set only, default = 0); opt_val = &nbio, opt_len = sizeof(nbio), nbio (integer): 0=blocking, non-blocking otherwise
 #define IOT_SOCKET_SO_RCVTIMEO          2       ///< Receive timeout in ms (default = 0); opt_val = &timeout, opt_len = sizeof(timeout)
 #define IOT_SOCKET_SO_SNDTIMEO          3       ///< Send timeout in ms (default = 0); opt_val = &timeout, opt_len = sizeof(timeout)
 #define IOT_SOCKET_SO_KEEPALIVE         4       ///< Keep-alive messages (default = 0); opt_val = &keepalive, opt_len = sizeof(keepalive), keepalive (integer): 0=disabled, enabled otherwise
 #define IOT_SOCKET_SO_TYPE              5       ///< Socket Type (Get only); opt_val = &socket_type, opt_len = sizeof(socket_type), socket_type (integer): IOT_SOCKET_SOCK_xxx
+#define IOT_SOCKET_TCP_NODELAY          6       ///< Disable Nagle algorithm (default = 0); opt_val = &nodelay, opt_len = sizeof(nodelay), nodelay (integer): 0=Nagle enabled, disabled otherwise
+#define IOT_SOCKET_TCP_CORK             7       ///< Hold partial segments (default = 0); opt_val = &cork, opt_len = sizeof(cork), cork (integer): 0=send, hold partial segments until cleared otherwise
+#define IOT_SOCKET_SO_RCVBUF            8       ///< Receive buffer size in bytes; opt_val = &size, opt_len = sizeof(size)
+#define IOT_SOCKET_SO_SNDBUF            9       ///< Send buffer size in bytes; opt_val = &size, opt_len = sizeof(size)
+#define IOT_SOCKET_TCP_WINDOW           10      ///< TCP window size hint in bytes (Set only); opt_val = &size, opt_len = sizeof(size)
+#define IOT_SOCKET_TCP_KEEPIDLE         11      ///< Keep-alive idle time in seconds; opt_val = &idle, opt_len = sizeof(idle)
+#define IOT_SOCKET_TCP_KEEPINTVL        12      ///< Keep-alive probe interval in seconds; opt_val = &interval, opt_len = sizeof(interval)
+#define IOT_SOCKET_TCP_KEEPCNT          13      ///< Keep-alive probe count; opt_val = &count, opt_len = sizeof(count)
+#define IOT_SOCKET_IP_ADD_MEMBERSHIP    14      ///< Join IPv4 multicast group (Set only); opt_val = &mreq, opt_len = sizeof(mreq), mreq: iotSocketMreq_t
+#define IOT_SOCKET_IP_DROP_MEMBERSHIP   15      ///< Leave IPv4 multicast group (Set only); opt_val = &mreq, opt_len = sizeof(mreq), mreq: iotSocketMreq_t
+#define IOT_SOCKET_IP_MULTICAST_TTL     16      ///< IPv4 multicast time-to-live (default = 1); opt_val = &ttl, opt_len = sizeof(ttl)
+#define IOT_SOCKET_IP_MULTICAST_LOOP    17      ///< IPv4 multicast loopback (default = 1); opt_val = &loop, opt_len = sizeof(loop), loop (integer): 0=disabled, enabled otherwise
+#define IOT_SOCKET_IPV6_JOIN_GROUP      18      ///< Join IPv6 multicast group (Set only); opt_val = &mreq, opt_len = sizeof(mreq), mreq: iotSocketMreq_t
+#define IOT_SOCKET_IPV6_LEAVE_GROUP     19      ///< Leave IPv6 multicast group (Set only); opt_val = &mreq, opt_len = sizeof(mreq), mreq: iotSocketMreq_t
+#define IOT_SOCKET_IPV6_MULTICAST_HOPS  20      ///< IPv6 multicast hop limit (default = 1); opt_val = &hops, opt_len = sizeof(hops)
+#define IOT_SOCKET_IPV6_MULTICAST_LOOP  21      ///< IPv6 multicast loopback (default = 1); opt_val = &loop, opt_len = sizeof(loop), loop (integer): 0=disabled, enabled otherwise
+#define IOT_SOCKET_SO_BROADCAST         22      ///< Send broadcast datagrams (default = 0); opt_val = &broadcast, opt_len = sizeof(broadcast), broadcast (integer): 0=disabled, enabled otherwise
+#define IOT_SOCKET_IP_TOS               23      ///< IPv4 type of service, DSCP and ECN (default = 0); opt_val = &tos, opt_len = sizeof(tos)
+#define IOT_SOCKET_SO_PRIORITY          24      ///< Transmit priority (default = 0); opt_val = &priority, opt_len = sizeof(priority), priority (integer): 0=normal, 1..7=high (higher value first)
+#define IOT_SOCKET_SO_LINGER            25      ///< Linger on close in seconds (default = -1); opt_val = &linger, opt_len = sizeof(linger), linger (integer): -1=disabled, 0=abort connection, wait up to linger seconds otherwise
+#define IOT_SOCKET_SO_REUSEADDR         26      ///< Reuse local address (default = 0); opt_val = &reuse, opt_len = sizeof(reuse), reuse (integer): 0=disabled, enabled otherwise
+#define IOT_SOCKET_IO_FIONREAD          27      ///< Bytes available to read (Get only); opt_val = &nread, opt_len = sizeof(nread), nread (integer): stream=queued bytes, datagram=length of next datagram
+#define IOT_SOCKET_SO_TIMESTAMP         28      ///< Timestamping of datagrams (default = 0); opt_val = &flags, opt_len = sizeof(flags), flags (integer): IOT_SOCKET_TIMESTAMP_xxx
+#define IOT_SOCKET_SO_TIMESTAMP_TX      29      ///< Timestamp of the last sent datagram (Get only); opt_val = &ts, opt_len = sizeof(ts), ts (iotSocketTimestamp_t)
 
 /**** Socket Return Codes ****/
 #define IOT_SOCKET_ERROR                (-1)    ///< Unspecified error
@@ -84,6 +143,26 @@ extern "C"
 #define IOT_SOCKET_EADDRINUSE           (-15)   ///< Address in use
 #define IOT_SOCKET_EHOSTNOTFOUND        (-16)   ///< Host not found
 
+/**** Address definitions ****/
+/// IP address returned by \ref iotSocketGetAddrInfo
+typedef struct {
+  uint8_t  ip[16];                      ///< IP address (IPv4 address uses the first 4 bytes)
+  uint32_t ip_len;                      ///< Length of 'ip' address in bytes (4 = IPv4, 16 = IPv6)
+} iotSocketAddr_t;
+
+/// Multicast group membership request
+typedef struct {
+  uint8_t  group[16];                   ///< Multicast group address (IPv4 address uses the first 4 bytes)
+  uint8_t  ifaddr[4];                   ///< Local IPv4 interface address (0.0.0.0 = default interface, not used for IPv6)
+} iotSocketMreq_t;
+
+/// Datagram timestamp
+typedef struct {
+  uint32_t sec;                         ///< Seconds
+  uint32_t nsec;                        ///< Nanoseconds
+  uint32_t hw;                          ///< Timestamp source: 1 = Ethernet MAC hardware, 0 = software
+} iotSocketTimestamp_t;
+
 
 /**
   \brief         Create a communication socket.
@@ -104,7 +183,7 @@ extern int32_t iotSocketCreate (int32_t af, int32_t type, int32_t protocol);
   \param[in]     socket   socket identification number.
   \param[in]     ip       pointer to local IP address.
   \param[in]     ip_len   length of 'ip' address in bytes.
-  \param[in]     port     local port number.
+  \param[in]     port     local port number (0 = any free port).
   \return        status information:
                  - 0                             = Operation successful.
                  - \ref IOT_SOCKET_ESOCK         = Invalid socket.
@@ -249,6 +328,158 @@ extern int32_t iotSocketSend (int32_t socket, const void *buf, uint32_t len);
  */
 extern int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port);
 
+/**
+  \brief         Receive data or check if data is available on a connected socket, with message flags.
+  \param[in]     socket   socket identification number.
+  \param[out]    buf      pointer to buffer where data should be stored.
+  \param[in]     len      length of buffer (in bytes), set len = 0 to check if data is available.
+  \param[in]     flags    message flags (IOT_SOCKET_MSG_xxx).
+  \return        status information:
+                 - number of bytes received (>=0), if len != 0.
+                 - real length of the datagram (>len), if IOT_SOCKET_MSG_TRUNC is set.
+                 - 0                             = Data is available (len = 0).
+                 - \ref IOT_SOCKET_ESOCK         = Invalid socket.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument (pointer to buffer, length or flags).
+                 - \ref IOT_SOCKET_ENOTSUP       = Flag not supported.
+                 - \ref IOT_SOCKET_ENOTCONN      = Socket is not connected.
+                 - \ref IOT_SOCKET_ECONNRESET    = Connection reset by the peer.
+                 - \ref IOT_SOCKET_ECONNABORTED  = Connection aborted locally.
+                 - \ref IOT_SOCKET_EAGAIN        = Operation would block or timed out (may be called again).
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketRecvEx (int32_t socket, void *buf, uint32_t len, uint32_t flags);
+
+/**
+  \brief         Send data or check if data can be sent on a connected socket, with message flags.
+  \param[in]     socket   socket identification number.
+  \param[in]     buf      pointer to buffer containing data to send.
+  \param[in]     len      length of data (in bytes), set len = 0 to check if data can be sent.
+  \param[in]     flags    message flags (IOT_SOCKET_MSG_DONTWAIT).
+  \return        status information:
+                 - number of bytes sent (>=0), if len != 0.
+                 - 0                             = Data can be sent (len = 0).
+                 - \ref IOT_SOCKET_ESOCK         = Invalid socket.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument (pointer to buffer, length or flags).
+                 - \ref IOT_SOCKET_ENOTCONN      = Socket is not connected.
+                 - \ref IOT_SOCKET_ECONNRESET    = Connection reset by the peer.
+                 - \ref IOT_SOCKET_ECONNABORTED  = Connection aborted locally.
+                 - \ref IOT_SOCKET_EAGAIN        = Operation would block or timed out (may be called again).
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketSendEx (int32_t socket, const void *buf, uint32_t len, uint32_t flags);
+
+/**
+  \brief         Accept a new connection on a socket, waiting at most for the given time.
+  \param[in]     socket   socket identification number.
+  \param[out]    ip       pointer to buffer where address of connecting socket shall be returned (NULL for none).
+  \param[in,out] ip_len   pointer to length of 'ip' (or NULL if 'ip' is NULL):
+                 - length of supplied 'ip' on input.
+                 - length of stored 'ip' on output.
+  \param[out]    port     pointer to buffer where port of connecting socket shall be returned (NULL for none).
+  \param[in,out] timeout  pointer to time budget in ms:
+                 - time available for the call on input.
+                 - time left on output (0 when expired).
+  \return        status information:
+                 - socket identification number of accepted socket (>=0).
+                 - \ref IOT_SOCKET_ESOCK         = Invalid socket.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument (socket not in listen mode or timeout).
+                 - \ref IOT_SOCKET_ENOTSUP       = Operation not supported.
+                 - \ref IOT_SOCKET_ECONNRESET    = Connection reset by the peer.
+                 - \ref IOT_SOCKET_ECONNABORTED  = Connection aborted locally.
+                 - \ref IOT_SOCKET_ETIMEDOUT     = Operation timed out.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketAcceptTimed (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port, uint32_t *timeout);
+
+/**
+  \brief         Connect a socket to a remote host, waiting at most for the given time.
+  \param[in]     socket   socket identification number.
+  \param[in]     ip       pointer to remote IP address.
+  \param[in]     ip_len   length of 'ip' address in bytes.
+  \param[in]     port     remote port number.
+  \param[in,out] timeout  pointer to time budget in ms:
+                 - time available for the call on input.
+                 - time left on output (0 when expired).
+  \return        status information:
+                 - 0                             = Operation successful.
+                 - \ref IOT_SOCKET_ESOCK         = Invalid socket.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument.
+                 - \ref IOT_SOCKET_ENOTSUP       = Operation not supported.
+                 - \ref IOT_SOCKET_EALREADY      = Connection already in progress.
+                 - \ref IOT_SOCKET_ECONNREFUSED  = Connection rejected by the peer.
+                 - \ref IOT_SOCKET_ECONNABORTED  = Connection aborted locally.
+                 - \ref IOT_SOCKET_EADDRINUSE    = Address already in use.
+                 - \ref IOT_SOCKET_ETIMEDOUT     = Operation timed out (socket must be closed).
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketConnectTimed (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port, uint32_t *timeout);
+
+/**
+  \brief         Receive data on a connected socket, waiting at most for the given time.
+  \param[in]     socket   socket identification number.
+  \param[out]    buf      pointer to buffer where data should be stored.
+  \param[in]     len      length of buffer (in bytes).
+  \param[in,out] timeout  pointer to time budget in ms:
+                 - time available for the call on input.
+                 - time left on output (0 when expired).
+  \return        status information:
+                 - number of bytes received (>0).
+                 - \ref IOT_SOCKET_ESOCK         = Invalid socket.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument (pointer to buffer, length or timeout).
+                 - \ref IOT_SOCKET_ENOTSUP       = Operation not supported.
+                 - \ref IOT_SOCKET_ENOTCONN      = Socket is not connected.
+                 - \ref IOT_SOCKET_ECONNRESET    = Connection reset by the peer.
+                 - \ref IOT_SOCKET_ECONNABORTED  = Connection aborted locally.
+                 - \ref IOT_SOCKET_ETIMEDOUT     = Operation timed out.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketRecvTimed (int32_t socket, void *buf, uint32_t len, uint32_t *timeout);
+
+/**
+  \brief         Send data on a connected socket, waiting at most for the given time.
+  \param[in]     socket   socket identification number.
+  \param[in]     buf      pointer to buffer containing data to send.
+  \param[in]     len      length of data (in bytes).
+  \param[in,out] timeout  pointer to time budget in ms:
+                 - time available for the call on input.
+                 - time left on output (0 when expired).
+  \return        status information:
+                 - number of bytes sent (>0).
+                 - \ref IOT_SOCKET_ESOCK         = Invalid socket.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument (pointer to buffer, length or timeout).
+                 - \ref IOT_SOCKET_ENOTSUP       = Operation not supported.
+                 - \ref IOT_SOCKET_ENOTCONN      = Socket is not connected.
+                 - \ref IOT_SOCKET_ECONNRESET    = Connection reset by the peer.
+                 - \ref IOT_SOCKET_ECONNABORTED  = Connection aborted locally.
+                 - \ref IOT_SOCKET_ETIMEDOUT     = Operation timed out.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketSendTimed (int32_t socket, const void *buf, uint32_t len, uint32_t *timeout);
+
+/**
+  \brief         Receive data on a socket together with its receive timestamp.
+  \param[in]     socket   socket identification number.
+  \param[out]    buf      pointer to buffer where data should be stored.
+  \param[in]     len      length of buffer (in bytes).
+  \param[out]    ip       pointer to buffer where remote source address shall be returned (NULL for none).
+  \param[in,out] ip_len   pointer to length of 'ip' (or NULL if 'ip' is NULL):
+                 - length of supplied 'ip' on input.
+                 - length of stored 'ip' on output.
+  \param[out]    port     pointer to buffer where remote source port shall be returned (NULL for none).
+  \param[out]    ts       pointer to buffer where receive timestamp shall be returned.
+  \return        status information:
+                 - number of bytes received (>0).
+                 - \ref IOT_SOCKET_ESOCK         = Invalid socket.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument (pointer to buffer, length or timestamp).
+                 - \ref IOT_SOCKET_ENOTSUP       = Operation not supported.
+                 - \ref IOT_SOCKET_ENOTCONN      = Socket is not connected.
+                 - \ref IOT_SOCKET_ECONNRESET    = Connection reset by the peer.
+                 - \ref IOT_SOCKET_ECONNABORTED  = Connection aborted locally.
+                 - \ref IOT_SOCKET_EAGAIN        = Operation would block or timed out (may be called again).
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketRecvFromTs (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port, iotSocketTimestamp_t *ts);
+
 /**
   \brief         Retrieve local IP address and port of a socket.
   \param[in]     socket   socket identification number.
@@ -314,6 +545,20 @@ extern int32_t iotSocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, u
  */
 extern int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, uint32_t opt_len);
 
+/**
+  \brief         Shut down part or all of a full-duplex connection.
+  \param[in]     socket   socket identification number.
+  \param[in]     how      direction to shut down (IOT_SOCKET_SHUT_xxx).
+  \return        status information:
+                 - 0                             = Operation successful.
+                 - \ref IOT_SOCKET_ESOCK         = Invalid socket.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument.
+                 - \ref IOT_SOCKET_ENOTCONN      = Socket is not connected.
+                 - \ref IOT_SOCKET_ENOTSUP       = Operation not supported.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketShutdown (int32_t socket, int32_t how);
+
 /**
   \brief         Close and release a socket.
   \param[in]     socket   socket identification number.
@@ -343,6 +588,41 @@ extern int32_t iotSocketClose (int32_t socket);
  */
 extern int32_t iotSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len);
 
+/**
+  \brief         Retrieve all host IP addresses from host name.
+  \param[in]     name     host name.
+  \param[in]     af       address family (\ref IOT_SOCKET_AF_UNSPEC for any).
+  \param[out]    addrs    pointer to array where resolved IP addresses shall be returned.
+  \param[in,out] count    pointer to number of addresses:
+                 - number of elements in 'addrs' (and 'ttls') on input.
+                 - number of stored addresses on output.
+  \param[out]    ttls     pointer to array where address lifetimes in seconds shall be returned (NULL for none, 0 = unknown).
+  \return        status information:
+                 - 0                             = Operation successful.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument.
+                 - \ref IOT_SOCKET_ENOTSUP       = Operation not supported.
+                 - \ref IOT_SOCKET_ENOMEM        = Not enough memory.
+                 - \ref IOT_SOCKET_ETIMEDOUT     = Operation timed out.
+                 - \ref IOT_SOCKET_EHOSTNOTFOUND = Host not found.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketGetAddrInfo (const char *name, int32_t af, iotSocketAddr_t *addrs, uint32_t *count, uint32_t *ttls);
+
+/**
+  \brief         Retrieve directed broadcast address of the local IPv4 network.
+  \param[out]    ip       pointer to buffer where broadcast address shall be returned.
+  \param[in,out] ip_len   pointer to length of 'ip' address in bytes:
+                 - length of supplied 'ip' on input.
+                 - length of stored 'ip' on output.
+  \return        status information:
+                 - 0                             = Operation successful.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument.
+                 - \ref IOT_SOCKET_ENOTSUP       = Operation not supported.
+                 - \ref IOT_SOCKET_ENOTCONN      = Network interface not configured.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketGetBroadcastAddr (uint8_t *ip, uint32_t *ip_len);
+
 #ifdef  __cplusplus
 }
 #endif
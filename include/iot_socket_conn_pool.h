@@ -0,0 +1,88 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * -------------------------------------------------------------------------- */
+
+#ifndef IOT_SOCKET_CONN_POOL_H_
+#define IOT_SOCKET_CONN_POOL_H_
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/**
+\brief Connection pool statistics.
+*/
+typedef struct {
+  uint32_t hits;                ///< Number of requests served with an idle connection
+  uint32_t misses;              ///< Number of requests that opened a new connection
+  uint32_t stale;               ///< Number of idle connections closed because they expired or failed the liveness check
+  uint32_t evictions;           ///< Number of idle connections closed to make room for a new one
+} iotSocketConnPoolStats_t;
+
+/**
+  \brief         Get a connected stream socket from the connection pool.
+  \param[in]     ip       pointer to remote IP address.
+  \param[in]     ip_len   length of 'ip' address in bytes.
+  \param[in]     port     remote port number.
+  \return        status information:
+                 - Socket identification number of connected socket (>=0).
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument.
+                 - \ref IOT_SOCKET_ENOMEM        = Not enough memory.
+                 - \ref IOT_SOCKET_EAGAIN        = Per-host connection limit reached.
+                 - \ref IOT_SOCKET_ECONNREFUSED  = Connection rejected by the peer.
+                 - \ref IOT_SOCKET_ETIMEDOUT     = Operation timed out.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketConnPoolGet (const uint8_t *ip, uint32_t ip_len, uint16_t port);
+
+/**
+  \brief         Return a socket to the connection pool.
+  \param[in]     socket   socket identification number returned by \ref iotSocketConnPoolGet.
+  \param[in]     reuse    0 = close the connection, keep it for reuse otherwise.
+  \return        status information:
+                 - 0                             = Operation successful.
+                 - \ref IOT_SOCKET_ESOCK         = Socket not handed out by the pool.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketConnPoolPut (int32_t socket, int32_t reuse);
+
+/**
+  \brief         Close all idle connections in the connection pool.
+  \return        status information:
+                 - 0                             = Operation successful.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketConnPoolFlush (void);
+
+/**
+  \brief         Retrieve connection pool statistics.
+  \param[out]    stats    pointer to structure where statistics shall be returned.
+  \return        status information:
+                 - 0                             = Operation successful.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketConnPoolGetStats (iotSocketConnPoolStats_t *stats);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* IOT_SOCKET_CONN_POOL_H_ */
@@ -0,0 +1,80 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * -------------------------------------------------------------------------- */
+
+#ifndef IOT_SOCKET_DNS_CACHE_H_
+#define IOT_SOCKET_DNS_CACHE_H_
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/**
+\brief DNS cache statistics.
+*/
+typedef struct {
+  uint32_t hits;                ///< Number of lookups answered from a positive cache entry
+  uint32_t neg_hits;            ///< Number of lookups answered from a negative cache entry
+  uint32_t misses;              ///< Number of lookups forwarded to the resolver
+  uint32_t evictions;           ///< Number of valid entries replaced to make room for a new one
+} iotSocketDnsCacheStats_t;
+
+/**
+  \brief         Retrieve host IP address from host name using the DNS cache.
+  \param[in]     name     host name.
+  \param[in]     af       address family.
+  \param[out]    ip       pointer to buffer where resolved IP address shall be returned.
+  \param[in,out] ip_len   pointer to length of 'ip':
+                 - length of supplied 'ip' on input.
+                 - length of stored 'ip' on output.
+  \return        status information:
+                 - 0                             = Operation successful.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument.
+                 - \ref IOT_SOCKET_ENOTSUP       = Operation not supported.
+                 - \ref IOT_SOCKET_ETIMEDOUT     = Operation timed out.
+                 - \ref IOT_SOCKET_EHOSTNOTFOUND = Host not found.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketDnsCacheGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len);
+
+/**
+  \brief         Remove entries from the DNS cache.
+  \param[in]     name     host name to remove (NULL removes all entries).
+  \return        status information:
+                 - 0                             = Operation successful.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketDnsCacheFlush (const char *name);
+
+/**
+  \brief         Retrieve DNS cache statistics.
+  \param[out]    stats    pointer to structure where statistics shall be returned.
+  \return        status information:
+                 - 0                             = Operation successful.
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketDnsCacheGetStats (iotSocketDnsCacheStats_t *stats);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* IOT_SOCKET_DNS_CACHE_H_ */
@@ -0,0 +1,66 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * -------------------------------------------------------------------------- */
+
+#ifndef IOT_SOCKET_HAPPY_EYEBALLS_H_
+#define IOT_SOCKET_HAPPY_EYEBALLS_H_
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include "iot_socket.h"
+
+/**
+  \brief         Connect a stream socket to one of the remote host addresses.
+  \param[in]     addrs    pointer to array of remote IP addresses.
+  \param[in]     count    number of elements in 'addrs'.
+  \param[in]     port     remote port number.
+  \param[in]     timeout  overall connect timeout in ms (0 = no timeout).
+  \return        status information:
+                 - Socket identification number of connected socket (>=0).
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument.
+                 - \ref IOT_SOCKET_ENOMEM        = Not enough memory.
+                 - \ref IOT_SOCKET_ECONNREFUSED  = Connection rejected by the peer.
+                 - \ref IOT_SOCKET_ETIMEDOUT     = Operation timed out.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketHappyEyeballsConnectAddr (const iotSocketAddr_t *addrs, uint32_t count, uint16_t port, uint32_t timeout);
+
+/**
+  \brief         Resolve host name and connect a stream socket to one of its addresses.
+  \param[in]     name     host name.
+  \param[in]     port     remote port number.
+  \param[in]     timeout  overall connect timeout in ms (0 = no timeout).
+  \return        status information:
+                 - Socket identification number of connected socket (>=0).
+                 - \ref IOT_SOCKET_EINVAL        = Invalid argument.
+                 - \ref IOT_SOCKET_ENOMEM        = Not enough memory.
+                 - \ref IOT_SOCKET_EHOSTNOTFOUND = Host not found.
+                 - \ref IOT_SOCKET_ECONNREFUSED  = Connection rejected by the peer.
+                 - \ref IOT_SOCKET_ETIMEDOUT     = Operation timed out.
+                 - \ref IOT_SOCKET_ERROR         = Unspecified error.
+ */
+extern int32_t iotSocketHappyEyeballsConnect (const char *name, uint16_t port, uint32_t timeout);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* IOT_SOCKET_HAPPY_EYEBALLS_H_ */
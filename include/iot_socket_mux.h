@@ -25,26 +25,37 @@ extern "C"
 #endif
 
 #include <stdint.h>
+#include "iot_socket.h"
 
 /**
 \brief Access structure of the IoT Socket API.
 */
 typedef struct {
-  int32_t (*SocketCreate)        (int32_t af, int32_t type, int32_t protocol);
-  int32_t (*SocketBind)          (int32_t socket, const uint8_t *ip, uint32_t  ip_len, uint16_t  port);
-  int32_t (*SocketListen)        (int32_t socket, int32_t backlog);
-  int32_t (*SocketAccept)        (int32_t socket,       uint8_t *ip, uint32_t *ip_len, uint16_t *port);
-  int32_t (*SocketConnect)       (int32_t socket, const uint8_t *ip, uint32_t  ip_len, uint16_t  port);
-  int32_t (*SocketRecv)          (int32_t socket, void *buf, uint32_t len);
-  int32_t (*SocketRecvFrom)      (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port);
-  int32_t (*SocketSend)          (int32_t socket, const void *buf, uint32_t len);
-  int32_t (*SocketSendTo)        (int32_t socket, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port);
-  int32_t (*SocketGetSockName)   (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port);
-  int32_t (*SocketGetPeerName)   (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port);
-  int32_t (*SocketGetOpt)        (int32_t socket, int32_t opt_id,       void *opt_val, uint32_t *opt_len);
-  int32_t (*SocketSetOpt)        (int32_t socket, int32_t opt_id, const void *opt_val, uint32_t  opt_len);
-  int32_t (*SocketClose)         (int32_t socket);
-  int32_t (*SocketGetHostByName) (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len);
+  int32_t (*SocketCreate)           (int32_t af, int32_t type, int32_t protocol);
+  int32_t (*SocketBind)             (int32_t socket, const uint8_t *ip, uint32_t  ip_len, uint16_t  port);
+  int32_t (*SocketListen)           (int32_t socket, int32_t backlog);
+  int32_t (*SocketAccept)           (int32_t socket,       uint8_t *ip, uint32_t *ip_len, uint16_t *port);
+  int32_t (*SocketConnect)          (int32_t socket, const uint8_t *ip, uint32_t  ip_len, uint16_t  port);
+  int32_t (*SocketRecv)             (int32_t socket, void *buf, uint32_t len);
+  int32_t (*SocketRecvFrom)         (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port);
+  int32_t (*SocketSend)             (int32_t socket, const void *buf, uint32_t len);
+  int32_t (*SocketSendTo)           (int32_t socket, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port);
+  int32_t (*SocketGetSockName)      (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port);
+  int32_t (*SocketGetPeerName)      (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port);
+  int32_t (*SocketGetOpt)           (int32_t socket, int32_t opt_id,       void *opt_val, uint32_t *opt_len);
+  int32_t (*SocketSetOpt)           (int32_t socket, int32_t opt_id, const void *opt_val, uint32_t  opt_len);
+  int32_t (*SocketClose)            (int32_t socket);
+  int32_t (*SocketGetHostByName)    (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len);
+  int32_t (*SocketGetAddrInfo)      (const char *name, int32_t af, iotSocketAddr_t *addrs, uint32_t *count, uint32_t *ttls);
+  int32_t (*SocketGetBroadcastAddr) (uint8_t *ip, uint32_t *ip_len);
+  int32_t (*SocketShutdown)         (int32_t socket, int32_t how);
+  int32_t (*SocketRecvEx)           (int32_t socket,       void *buf, uint32_t len, uint32_t flags);
+  int32_t (*SocketSendEx)           (int32_t socket, const void *buf, uint32_t len, uint32_t flags);
+  int32_t (*SocketAcceptTimed)      (int32_t socket,       uint8_t *ip, uint32_t *ip_len, uint16_t *port, uint32_t *timeout);
+  int32_t (*SocketConnectTimed)     (int32_t socket, const uint8_t *ip, uint32_t  ip_len, uint16_t  port, uint32_t *timeout);
+  int32_t (*SocketRecvTimed)        (int32_t socket,       void *buf, uint32_t len, uint32_t *timeout);
+  int32_t (*SocketSendTimed)        (int32_t socket, const void *buf, uint32_t len, uint32_t *timeout);
+  int32_t (*SocketRecvFromTs)       (int32_t socket,       void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port, iotSocketTimestamp_t *ts);
 } iotSocketApi_t;
 
 /**
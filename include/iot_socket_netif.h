@@ -0,0 +1,56 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * -------------------------------------------------------------------------- */
+
+#ifndef IOT_SOCKET_NETIF_H_
+#define IOT_SOCKET_NETIF_H_
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include "iot_socket.h"
+
+/**
+\brief Access structure of the network interface extensions.
+*/
+typedef struct {
+  int32_t (*AddMulticastMAC)    (const uint8_t *mac);
+  int32_t (*RemoveMulticastMAC) (const uint8_t *mac);
+  int32_t (*SetTxPriority)      (uint16_t port, uint8_t priority);
+  int32_t (*GetTxPriority)      (uint16_t port);
+  int32_t (*GetRxTimestamp)     (const void *frame, iotSocketTimestamp_t *ts);
+  int32_t (*SetTxTimestamp)     (uint16_t port, uint32_t enable);
+  int32_t (*GetTxTimestamp)     (uint16_t port, iotSocketTimestamp_t *ts);
+} iotSocketNetifApi_t;
+
+/**
+  \brief         Register network interface extensions.
+  \param[in]     netif    pointer to network interface access structure (NULL disables the extensions)
+  \return        status information:
+                 - 0              = Operation successful.
+                 - negative value = error.
+ */
+extern int32_t iotSocketRegisterNetif (const iotSocketNetifApi_t *netif);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* IOT_SOCKET_NETIF_H_ */
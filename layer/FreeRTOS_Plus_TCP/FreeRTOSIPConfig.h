@@ -59,8 +59,11 @@
 
 /* If the network card/driver includes checksum offloading (IP/TCP/UDP checksums)
  * then set ipconfigDRIVER_INCLUDED_RX_IP_CHECKSUM to 1 to prevent the software
- * stack repeating the checksum calculations. */
+ * stack repeating the checksum calculations.  The network interface enables
+ * checksum offload reported by the Ethernet MAC capabilities and calculates
+ * the checksums in software when the MAC does not support it. */
 #define ipconfigDRIVER_INCLUDED_RX_IP_CHECKSUM     1
+#define ipconfigDRIVER_INCLUDED_TX_IP_CHECKSUM     1
 
 /* Several API's will block until the result is known, or the action has been
  * performed, for example FreeRTOS_send() and FreeRTOS_recv().  The timeouts can be
@@ -212,7 +215,8 @@
 /* USE_TCP: Use TCP and all its features */
 #define ipconfigUSE_TCP                                ( 1 )
 
-/* USE_WIN: Let TCP use windowing mechanism. */
+/* USE_WIN: Let TCP use windowing mechanism. Required for per-socket window
+ * sizes (IOT_SOCKET_TCP_WINDOW returns IOT_SOCKET_ENOTSUP when disabled). */
 #define ipconfigUSE_TCP_WIN                            ( 0 )
 
 /* The MTU is the maximum number of bytes the payload of a network frame can
@@ -280,9 +284,21 @@
  * real program memory (RAM or flash) or just has a random non-zero value. */
 #define ipconfigIS_VALID_PROG_ADDRESS( x )    ( ( x ) != NULL )
 
-/* Include support for TCP keep-alive messages. */
+/* Include support for TCP keep-alive messages. The interval is the idle time
+ * before the first probe and can be overridden on the compiler command line. */
 #define ipconfigTCP_KEEP_ALIVE                   ( 1 )
+#ifndef ipconfigTCP_KEEP_ALIVE_INTERVAL
 #define ipconfigTCP_KEEP_ALIVE_INTERVAL          ( 20 ) /* in seconds */
+#endif
+
+/* Include support for multicast group membership (IGMP). Joined groups are
+ * added to the Ethernet MAC address filter of the network interface. */
+#define ipconfigSUPPORT_IP_MULTICAST             ( 1 )
+
+/* If ipconfigUSE_LINKED_RX_MESSAGES is set to 1 then the network interface
+ * passes up to ETH_RX_BATCH_LEN received frames to the IP task in one event,
+ * which saves a context switch per frame during bursts. */
+#define ipconfigUSE_LINKED_RX_MESSAGES           ( 1 )
 
 /* The socket semaphore is used to unblock the MQTT task. */
 #define ipconfigSOCKET_HAS_USER_SEMAPHORE        ( 0 )
@@ -0,0 +1,593 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * -------------------------------------------------------------------------- */
+
+/* Host (Linux) implementation of CMSIS-Driver Ethernet MAC and PHY.
+
+   Frames are exchanged through:
+   - an in-process frame pipe: ETH_Host_Inject puts frames into the receive
+     pipe, frames sent by the MAC are passed to the ETH_Host_SetTxHook callback,
+   - a Linux TAP device (optional, define ETH_HOST_TAP as the device name). */
+
+#include <string.h>
+
+#ifdef ETH_HOST_TAP
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+#endif
+
+#include "Driver_ETH_MAC.h"
+#include "Driver_ETH_PHY.h"
+#include "cmsis_os2.h"
+
+#include "ETH_Host.h"
+
+/* Driver number (Driver_ETH_MAC# and Driver_ETH_PHY#) */
+#ifndef ETH_HOST_DRV_NUM
+#define ETH_HOST_DRV_NUM        0
+#endif
+
+/* Number of frames in the receive pipe */
+#ifndef ETH_HOST_RX_PIPE_LEN
+#define ETH_HOST_RX_PIPE_LEN    64
+#endif
+
+/* Maximum frame size */
+#define ETH_HOST_FRAME_SIZE     1536U
+
+#define ARM_ETH_MAC_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+#define ARM_ETH_PHY_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+#define _ETH_HOST_MAC_(n)       Driver_ETH_MAC##n
+#define  ETH_HOST_MAC_(n)       _ETH_HOST_MAC_(n)
+#define _ETH_HOST_PHY_(n)       Driver_ETH_PHY##n
+#define  ETH_HOST_PHY_(n)       _ETH_HOST_PHY_(n)
+
+static const ARM_DRIVER_VERSION MAC_DriverVersion = {
+  ARM_ETH_MAC_API_VERSION,
+  ARM_ETH_MAC_DRV_VERSION
+};
+
+static const ARM_DRIVER_VERSION PHY_DriverVersion = {
+  ARM_ETH_PHY_API_VERSION,
+  ARM_ETH_PHY_DRV_VERSION
+};
+
+/* No checksum offload, checksums are handled by the network interface */
+static const ARM_ETH_MAC_CAPABILITIES MAC_Capabilities = {
+  0,                            /* checksum_offload_rx_ip4  */
+  0,                            /* checksum_offload_rx_ip6  */
+  0,                            /* checksum_offload_rx_udp  */
+  0,                            /* checksum_offload_rx_tcp  */
+  0,                            /* checksum_offload_rx_icmp */
+  0,                            /* checksum_offload_tx_ip4  */
+  0,                            /* checksum_offload_tx_ip6  */
+  0,                            /* checksum_offload_tx_udp  */
+  0,                            /* checksum_offload_tx_tcp  */
+  0,                            /* checksum_offload_tx_icmp */
+  ARM_ETH_INTERFACE_MII,        /* media_interface          */
+  0,                            /* mac_address              */
+  1,                            /* event_rx_frame           */
+  1,                            /* event_tx_frame           */
+  0,                            /* event_wakeup             */
+  0,                            /* precision_timer          */
+  0                             /* reserved                 */
+};
+
+/* Receive pipe (single producer, single consumer) */
+static struct {
+  uint32_t len;
+  uint8_t  buf[ETH_HOST_FRAME_SIZE];
+} RX_Pipe[ETH_HOST_RX_PIPE_LEN];
+
+static volatile uint32_t RX_head;
+static volatile uint32_t RX_tail;
+
+/* Transmit frame assembled from fragments */
+static uint8_t  TX_buf[ETH_HOST_FRAME_SIZE];
+static uint32_t TX_len;
+
+static ARM_ETH_MAC_SignalEvent_t MAC_cb_event;
+static ARM_ETH_MAC_ADDR          MAC_addr;
+static uint32_t                  MAC_power;
+static uint32_t                  MAC_rx_enabled;
+static uint32_t                  MAC_tx_enabled;
+static volatile uint32_t         PHY_link = 1U;
+
+static ETH_Host_TxHook_t         TX_hook;
+static ETH_Host_Stats_t          Stats;
+
+#ifdef ETH_HOST_TAP
+/* TAP device, the frame buffer is filled by TAP_Thread and read by the MAC driver */
+static int           TAP_fd = -1;
+static uint32_t      TAP_len;
+static uint8_t       TAP_buf[ETH_HOST_FRAME_SIZE];
+static osMutexId_t   TAP_mutex;
+static osThreadId_t  TAP_tid;
+
+/**
+  Open TAP device.
+
+  \return        file descriptor, -1 on error
+*/
+static int TAP_Open (void) {
+  struct ifreq ifr;
+  int fd;
+
+  fd = open ("/dev/net/tun", O_RDWR | O_NONBLOCK);
+  if (fd < 0) {
+    return -1;
+  }
+
+  memset (&ifr, 0, sizeof(ifr));
+  ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+  strncpy (ifr.ifr_name, ETH_HOST_TAP, IFNAMSIZ - 1);
+
+  if (ioctl (fd, TUNSETIFF, &ifr) < 0) {
+    close (fd);
+    return -1;
+  }
+  return fd;
+}
+
+/**
+  Simulate receive interrupt for the TAP device.
+  Host file descriptors cannot signal RTOS threads, the device is polled once per tick.
+*/
+static void TAP_Thread (void *arg) {
+  struct pollfd pfd;
+  uint32_t len;
+  ssize_t n;
+
+  (void)arg;
+
+  for (;;) {
+    pfd.fd      = TAP_fd;
+    pfd.events  = POLLIN;
+    pfd.revents = 0;
+
+    osMutexAcquire (TAP_mutex, osWaitForever);
+    if ((TAP_len == 0U) && (poll (&pfd, 1, 0) > 0)) {
+      /* Buffer is free, read the next frame */
+      n = read (TAP_fd, TAP_buf, sizeof(TAP_buf));
+      if (n > 0) {
+        TAP_len = (uint32_t)n;
+      }
+    }
+    len = TAP_len;
+    osMutexRelease (TAP_mutex);
+
+    if ((MAC_rx_enabled != 0U) && (len != 0U) && (MAC_cb_event != NULL)) {
+      MAC_cb_event (ARM_ETH_MAC_EVENT_RX_FRAME);
+    }
+    osDelay (1U);
+  }
+}
+
+/**
+  Get size of the frame in the TAP buffer.
+
+  eturn        frame size, 0 when no frame is pending
+*/
+static uint32_t TAP_GetSize (void) {
+  uint32_t len;
+
+  osMutexAcquire (TAP_mutex, osWaitForever);
+  len = TAP_len;
+  osMutexRelease (TAP_mutex);
+
+  return len;
+}
+
+/**
+  Read the frame from the TAP buffer and release the buffer.
+
+  \param[out]    frame  buffer for the frame (NULL = discard the frame)
+  \param[in]     len    buffer length
+  eturn        number of bytes copied, 0 when no frame is pending
+*/
+static uint32_t TAP_Read (uint8_t *frame, uint32_t len) {
+
+  osMutexAcquire (TAP_mutex, osWaitForever);
+  if (len > TAP_len) {
+    len = TAP_len;
+  }
+  if ((frame != NULL) && (len != 0U)) {
+    memcpy (frame, TAP_buf, len);
+  }
+  TAP_len = 0U;
+  osMutexRelease (TAP_mutex);
+
+  return len;
+}
+#endif
+
+/* In-process frame pipe */
+
+int32_t ETH_Host_Inject (const uint8_t *frame, uint32_t len) {
+  uint32_t next;
+
+  if ((frame == NULL) || (len == 0U) || (len > ETH_HOST_FRAME_SIZE)) {
+    return -1;
+  }
+
+  next = (RX_head + 1U) % ETH_HOST_RX_PIPE_LEN;
+  if (next == RX_tail) {
+    Stats.rx_dropped++;
+    return -1;
+  }
+
+  memcpy (RX_Pipe[RX_head].buf, frame, len);
+  RX_Pipe[RX_head].len = len;
+  RX_head = next;
+
+  if ((MAC_rx_enabled != 0U) && (MAC_cb_event != NULL)) {
+    MAC_cb_event (ARM_ETH_MAC_EVENT_RX_FRAME);
+  }
+  return 0;
+}
+
+void ETH_Host_SetTxHook (ETH_Host_TxHook_t hook) {
+  TX_hook = hook;
+}
+
+void ETH_Host_SetLink (uint32_t up) {
+  PHY_link = (up != 0U) ? 1U : 0U;
+}
+
+void ETH_Host_GetStats (ETH_Host_Stats_t *stats) {
+  if (stats != NULL) {
+    *stats = Stats;
+  }
+}
+
+/* Ethernet MAC driver */
+
+static ARM_DRIVER_VERSION MAC_GetVersion (void) {
+  return MAC_DriverVersion;
+}
+
+static ARM_ETH_MAC_CAPABILITIES MAC_GetCapabilities (void) {
+  return MAC_Capabilities;
+}
+
+static int32_t MAC_Initialize (ARM_ETH_MAC_SignalEvent_t cb_event) {
+  MAC_cb_event = cb_event;
+  RX_head      = 0U;
+  RX_tail      = 0U;
+  TX_len       = 0U;
+  return ARM_DRIVER_OK;
+}
+
+static int32_t MAC_Uninitialize (void) {
+  MAC_cb_event = NULL;
+  return ARM_DRIVER_OK;
+}
+
+static int32_t MAC_PowerControl (ARM_POWER_STATE state) {
+
+  switch (state) {
+    case ARM_POWER_OFF:
+      MAC_rx_enabled = 0U;
+      MAC_tx_enabled = 0U;
+      MAC_power      = 0U;
+      break;
+
+    case ARM_POWER_FULL:
+#ifdef ETH_HOST_TAP
+      if (TAP_fd < 0) {
+        TAP_mutex = osMutexNew (NULL);
+        if (TAP_mutex == NULL) {
+          return ARM_DRIVER_ERROR;
+        }
+        TAP_fd = TAP_Open ();
+        if (TAP_fd < 0) {
+          return ARM_DRIVER_ERROR;
+        }
+        TAP_tid = osThreadNew (TAP_Thread, NULL, NULL);
+        if (TAP_tid == NULL) {
+          return ARM_DRIVER_ERROR;
+        }
+      }
+#endif
+      MAC_power = 1U;
+      break;
+
+    default:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+  return ARM_DRIVER_OK;
+}
+
+static int32_t MAC_GetMacAddress (ARM_ETH_MAC_ADDR *ptr_addr) {
+  if (ptr_addr == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  *ptr_addr = MAC_addr;
+  return ARM_DRIVER_OK;
+}
+
+static int32_t MAC_SetMacAddress (const ARM_ETH_MAC_ADDR *ptr_addr) {
+  if (ptr_addr == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  MAC_addr = *ptr_addr;
+  return ARM_DRIVER_OK;
+}
+
+static int32_t MAC_SetAddressFilter (const ARM_ETH_MAC_ADDR *ptr_addr, uint32_t num_addr) {
+  /* Frames are filtered by the network interface */
+  (void)ptr_addr;
+  (void)num_addr;
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t MAC_SendFrame (const uint8_t *frame, uint32_t len, uint32_t flags) {
+
+  if ((frame == NULL) || (len == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((MAC_power == 0U) || (MAC_tx_enabled == 0U)) {
+    return ARM_DRIVER_ERROR;
+  }
+  if ((TX_len + len) > ETH_HOST_FRAME_SIZE) {
+    TX_len = 0U;
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+
+  memcpy (&TX_buf[TX_len], frame, len);
+  TX_len += len;
+
+  if ((flags & ARM_ETH_MAC_TX_FRAME_FRAGMENT) != 0U) {
+    /* More fragments follow */
+    return ARM_DRIVER_OK;
+  }
+
+  if (TX_hook != NULL) {
+    TX_hook (TX_buf, TX_len);
+  }
+#ifdef ETH_HOST_TAP
+  if (TAP_fd >= 0) {
+    (void)write (TAP_fd, TX_buf, TX_len);
+  }
+#endif
+  TX_len = 0U;
+  Stats.tx_frames++;
+
+  if (((flags & ARM_ETH_MAC_TX_FRAME_EVENT) != 0U) && (MAC_cb_event != NULL)) {
+    MAC_cb_event (ARM_ETH_MAC_EVENT_TX_FRAME);
+  }
+  return ARM_DRIVER_OK;
+}
+
+static uint32_t MAC_GetRxFrameSize (void) {
+
+  if (MAC_rx_enabled == 0U) {
+    return 0U;
+  }
+  if (RX_tail != RX_head) {
+    return RX_Pipe[RX_tail].len;
+  }
+#ifdef ETH_HOST_TAP
+  if (TAP_fd >= 0) {
+    return TAP_GetSize ();
+  }
+  return 0U;
+#else
+  return 0U;
+#endif
+}
+
+static int32_t MAC_ReadFrame (uint8_t *frame, uint32_t len) {
+  uint32_t size;
+
+  if (MAC_rx_enabled == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (RX_tail != RX_head) {
+    size = RX_Pipe[RX_tail].len;
+    if (len > size) {
+      len = size;
+    }
+    if ((frame != NULL) && (len != 0U)) {
+      memcpy (frame, RX_Pipe[RX_tail].buf, len);
+    }
+
+    /* Release the frame */
+    RX_tail = (RX_tail + 1U) % ETH_HOST_RX_PIPE_LEN;
+  }
+#ifdef ETH_HOST_TAP
+  else if ((TAP_fd >= 0) && (TAP_GetSize () != 0U)) {
+    len = TAP_Read (frame, len);
+  }
+#endif
+  else {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if ((frame != NULL) && (len != 0U)) {
+    Stats.rx_frames++;
+  }
+
+  return (int32_t)len;
+}
+
+static int32_t MAC_GetRxFrameTime (ARM_ETH_MAC_TIME *time) {
+  (void)time;
+
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+static int32_t MAC_GetTxFrameTime (ARM_ETH_MAC_TIME *time) {
+  (void)time;
+
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+static int32_t MAC_ControlTimer (uint32_t control, ARM_ETH_MAC_TIME *time) {
+  (void)control;
+  (void)time;
+
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+static int32_t MAC_Control (uint32_t control, uint32_t arg) {
+
+  switch (control) {
+    case ARM_ETH_MAC_CONFIGURE:
+      /* Speed, duplex and address filtering are not emulated */
+      break;
+
+    case ARM_ETH_MAC_CONTROL_TX:
+      MAC_tx_enabled = (arg != 0U) ? 1U : 0U;
+      break;
+
+    case ARM_ETH_MAC_CONTROL_RX:
+      MAC_rx_enabled = (arg != 0U) ? 1U : 0U;
+      break;
+
+    case ARM_ETH_MAC_FLUSH:
+      if ((arg & ARM_ETH_MAC_FLUSH_RX) != 0U) {
+        RX_tail = RX_head;
+#ifdef ETH_HOST_TAP
+        if (TAP_fd >= 0) {
+          (void)TAP_Read (NULL, 0U);
+        }
+#endif
+      }
+      if ((arg & ARM_ETH_MAC_FLUSH_TX) != 0U) {
+        TX_len = 0U;
+      }
+      break;
+
+    default:
+      return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+  return ARM_DRIVER_OK;
+}
+
+static int32_t MAC_PHY_Read (uint8_t phy_addr, uint8_t reg_addr, uint16_t *data) {
+  (void)phy_addr;
+  (void)reg_addr;
+
+  if (data == NULL) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  *data = 0U;
+  return ARM_DRIVER_OK;
+}
+
+static int32_t MAC_PHY_Write (uint8_t phy_addr, uint8_t reg_addr, uint16_t data) {
+  (void)phy_addr;
+  (void)reg_addr;
+  (void)data;
+
+  return ARM_DRIVER_OK;
+}
+
+/* Ethernet PHY driver */
+
+static ARM_DRIVER_VERSION PHY_GetVersion (void) {
+  return PHY_DriverVersion;
+}
+
+static int32_t PHY_Initialize (ARM_ETH_PHY_Read_t fn_read, ARM_ETH_PHY_Write_t fn_write) {
+  (void)fn_read;
+  (void)fn_write;
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t PHY_Uninitialize (void) {
+  return ARM_DRIVER_OK;
+}
+
+static int32_t PHY_PowerControl (ARM_POWER_STATE state) {
+
+  if ((state != ARM_POWER_OFF) && (state != ARM_POWER_FULL)) {
+    return ARM_DRIVER_ERROR_UNSUPPORTED;
+  }
+  return ARM_DRIVER_OK;
+}
+
+static int32_t PHY_SetInterface (uint32_t interface) {
+  (void)interface;
+
+  return ARM_DRIVER_OK;
+}
+
+static int32_t PHY_SetMode (uint32_t mode) {
+  (void)mode;
+
+  return ARM_DRIVER_OK;
+}
+
+static ARM_ETH_LINK_STATE PHY_GetLinkState (void) {
+  return ((MAC_power != 0U) && (PHY_link != 0U)) ? ARM_ETH_LINK_UP : ARM_ETH_LINK_DOWN;
+}
+
+static ARM_ETH_LINK_INFO PHY_GetLinkInfo (void) {
+  ARM_ETH_LINK_INFO info;
+
+  /* 1Gbit, full duplex */
+  memset (&info, 0, sizeof(info));
+  info.speed  = 2U;
+  info.duplex = 1U;
+
+  return info;
+}
+
+/* Driver access structures */
+
+extern ARM_DRIVER_ETH_MAC ETH_HOST_MAC_(ETH_HOST_DRV_NUM);
+ARM_DRIVER_ETH_MAC ETH_HOST_MAC_(ETH_HOST_DRV_NUM) = {
+  MAC_GetVersion,
+  MAC_GetCapabilities,
+  MAC_Initialize,
+  MAC_Uninitialize,
+  MAC_PowerControl,
+  MAC_GetMacAddress,
+  MAC_SetMacAddress,
+  MAC_SetAddressFilter,
+  MAC_SendFrame,
+  MAC_ReadFrame,
+  MAC_GetRxFrameSize,
+  MAC_GetRxFrameTime,
+  MAC_GetTxFrameTime,
+  MAC_ControlTimer,
+  MAC_Control,
+  MAC_PHY_Read,
+  MAC_PHY_Write
+};
+
+extern ARM_DRIVER_ETH_PHY ETH_HOST_PHY_(ETH_HOST_DRV_NUM);
+ARM_DRIVER_ETH_PHY ETH_HOST_PHY_(ETH_HOST_DRV_NUM) = {
+  PHY_GetVersion,
+  PHY_Initialize,
+  PHY_Uninitialize,
+  PHY_PowerControl,
+  PHY_SetInterface,
+  PHY_SetMode,
+  PHY_GetLinkState,
+  PHY_GetLinkInfo
+};
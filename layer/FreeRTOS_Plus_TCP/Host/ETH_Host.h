@@ -0,0 +1,76 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * -------------------------------------------------------------------------- */
+
+#ifndef ETH_HOST_H__
+#define ETH_HOST_H__
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/**
+  \brief Callback function receiving frames sent by the Ethernet MAC.
+  \param[in]     frame  Ethernet frame
+  \param[in]     len    frame length
+*/
+typedef void (*ETH_Host_TxHook_t) (const uint8_t *frame, uint32_t len);
+
+/**
+  \brief Host Ethernet statistics.
+*/
+typedef struct {
+  uint32_t tx_frames;           ///< Number of frames sent
+  uint32_t rx_frames;           ///< Number of frames received
+  uint32_t rx_dropped;          ///< Number of frames dropped (receive pipe full)
+} ETH_Host_Stats_t;
+
+/**
+  \brief         Inject a frame into the receive pipe of the Ethernet MAC.
+                 Must be called from an RTOS thread (signals the receive event).
+  \param[in]     frame  Ethernet frame
+  \param[in]     len    frame length
+  \return        0 on success, -1 when the receive pipe is full or the frame is too long
+*/
+extern int32_t ETH_Host_Inject (const uint8_t *frame, uint32_t len);
+
+/**
+  \brief         Register callback function receiving frames sent by the Ethernet MAC.
+  \param[in]     hook   callback function (NULL = frames are sent to the TAP device only)
+*/
+extern void ETH_Host_SetTxHook (ETH_Host_TxHook_t hook);
+
+/**
+  \brief         Set Ethernet PHY link state.
+  \param[in]     up     0 = link down, link up otherwise
+*/
+extern void ETH_Host_SetLink (uint32_t up);
+
+/**
+  \brief         Retrieve host Ethernet statistics.
+  \param[out]    stats  pointer to structure where statistics shall be returned
+*/
+extern void ETH_Host_GetStats (ETH_Host_Stats_t *stats);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* ETH_HOST_H__ */
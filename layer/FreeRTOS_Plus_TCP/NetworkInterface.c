@@ -1,5 +1,5 @@
 /* -----------------------------------------------------------------------------
- * Copyright (c) 2021-2024 Arm Limited (or its affiliates). All rights reserved.
+ * Copyright (c) 2021-2026 Arm Limited (or its affiliates). All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -16,6 +16,8 @@
  * limitations under the License.
  * -------------------------------------------------------------------------- */
 
+#include <string.h>
+
 #include "FreeRTOS.h"
 #include "FreeRTOS_IP.h"
 #include "FreeRTOS_IP_Private.h"
@@ -25,177 +27,1413 @@
 #include "Driver_ETH_PHY.h"
 #include "cmsis_os2.h"
 
-#include "NetworkInterfaceConfig.h"
+#include "iot_socket_netif.h"
+
+#include "NetworkInterfaceConfig.h"
+
+/* If ipconfigETHERNET_DRIVER_FILTERS_FRAME_TYPES is set to 1, then the Ethernet
+ * driver will filter incoming packets and only pass the stack those packets it
+ * considers need processing. */
+#if (ipconfigETHERNET_DRIVER_FILTERS_FRAME_TYPES == 0)
+    #define ipCONSIDER_FRAME_FOR_PROCESSING(pucEthernetBuffer)    eProcessBuffer
+#else
+    #define ipCONSIDER_FRAME_FOR_PROCESSING(pucEthernetBuffer)    eConsiderFrameForProcessing((pucEthernetBuffer))
+#endif
+
+/* Reference to the underlying Ethernet MAC driver */
+#define _ARM_Driver_ETH_MAC_(n)           Driver_ETH_MAC##n
+#define  ARM_Driver_ETH_MAC_(n)      _ARM_Driver_ETH_MAC_(n)
+
+extern ARM_DRIVER_ETH_MAC             ARM_Driver_ETH_MAC_(ETH_DRV_NUM);
+#define Driver_ETH_MAC              (&ARM_Driver_ETH_MAC_(ETH_DRV_NUM))
+
+extern ARM_DRIVER_ETH_PHY             ARM_Driver_ETH_PHY_(ETH_PHY_NUM);
+#define Driver_ETH_PHY              (&ARM_Driver_ETH_PHY_(ETH_PHY_NUM))
+
+static const osThreadAttr_t ETH_Thread_attr = {
+  .name       = "ETH_Thread",
+  .priority   = osPriorityHigh,
+  .stack_size = ETH_THREAD_STACK_SIZE
+};
+
+osThreadId_t ETH_tid;
+
+/* Multicast MAC address filter */
+static struct {
+  ARM_ETH_MAC_ADDR addr;
+  uint8_t          ref;
+} MCast_MAC[ETH_MCAST_NUM];
+
+static osMutexId_t MCast_mutex;
+static uint32_t    MCast_all;
+static uint32_t    MAC_ctrl;
+
+/* Ethernet link state */
+static volatile ARM_ETH_LINK_STATE LINK_state = ARM_ETH_LINK_DOWN;
+static ARM_ETH_LINK_INFO           LINK_info;
+static void                      (*LINK_hook) (BaseType_t xLinkUp);
+static volatile uint32_t           LINK_wait;
+
+/* Transmit priority of local ports */
+static struct {
+  uint16_t port;
+  uint8_t  prio;
+} TX_Prio[ETH_TX_PRIO_NUM];
+
+/* Transmit queue, ordered by priority */
+static struct {
+  NetworkBufferDescriptor_t *buf;
+  uint8_t                    prio;
+} TX_Queue[ETH_TX_QUEUE_LEN];
+
+static osMutexId_t TX_mutex;
+static uint32_t    TX_count;
+static uint32_t    TX_drop;                     /* Frames dropped on a full transmit queue */
+static uint32_t    TX_event;                    /* SendFrame flag requesting the transmit event (0 = not signaled) */
+
+/* Signals free space in the transmit queue */
+static osEventFlagsId_t TX_evt;
+
+/* Timestamp clock */
+static uint32_t    TS_hw;                       /* Ethernet MAC precision timer available */
+static uint32_t    TS_last;                     /* Last read system timer count */
+static uint64_t    TS_count;                    /* System timer count extended to 64 bits */
+
+/* Receive timestamps, one entry per network buffer descriptor */
+#define RX_TS_INDEX(buf)            (((uintptr_t)(buf) / sizeof(NetworkBufferDescriptor_t)) % ipconfigNUM_NETWORK_BUFFER_DESCRIPTORS)
+
+static struct {
+  const NetworkBufferDescriptor_t *buf;
+  ARM_ETH_MAC_TIME                 time;
+  uint32_t                         hw;
+} RX_Ts[ipconfigNUM_NETWORK_BUFFER_DESCRIPTORS];
+
+/* Transmit timestamps of local ports */
+static struct {
+  uint16_t         port;
+  uint16_t         valid;
+  ARM_ETH_MAC_TIME time;
+  uint32_t         hw;
+} TX_Ts[ETH_TX_TS_NUM];
+
+static uint32_t    TX_ts_num;                   /* Number of timestamped ports */
+static uint32_t    TX_ts_wait;                  /* Entry waiting for the MAC timestamp + 1 (0 = none) */
+static uint32_t    TX_ts_tick;                  /* Time the MAC timestamp was requested */
+
+/* Checksums calculated by the Ethernet MAC */
+#define CKS_IP4         0x01U
+#define CKS_IP6         0x02U
+#define CKS_UDP         0x04U
+#define CKS_TCP         0x08U
+#define CKS_ICMP        0x10U
+#define CKS_PROTO       (CKS_UDP | CKS_TCP | CKS_ICMP)
+
+static uint32_t    CKS_rx;
+static uint32_t    CKS_tx;
+
+/* Receive batch for the TCP/IP stack */
+static NetworkBufferDescriptor_t *RX_head;
+static NetworkBufferDescriptor_t *RX_tail;
+static uint32_t    RX_batch;
+
+/* Receive batch size distribution, bin n counts batches of 2^n to 2^(n+1)-1 frames */
+#define ETH_RX_BATCH_BINS           8U
+static uint32_t    RX_batch_hist[ETH_RX_BATCH_BINS];
+
+/* Receive moderation, frames are polled while RX_poll is set */
+static volatile uint32_t RX_poll;
+
+#if (ETH_RX_MODERATION != 0)
+/* Receive rate measurement period [ms] */
+#define ETH_RX_RATE_PERIOD          100U
+
+static uint32_t    RX_rate;                     /* Receive rate [frames/s] */
+static uint32_t    RX_rate_num;                 /* Frames received in the current period */
+static uint32_t    RX_rate_tick;                /* Start of the current period */
+static uint32_t    RX_poll_tick;                /* Time of the last frame received while polling */
+#endif
+
+/* Receive drop counters */
+#define RX_DROP_ADDR                0U      /* Destination address not accepted */
+#define RX_DROP_TYPE                1U      /* Frame type or VLAN not accepted */
+#define RX_DROP_CKSUM               2U      /* Invalid checksum */
+#define RX_DROP_NOBUF               3U      /* No network buffer or TCP/IP stack busy */
+#define RX_DROP_NUM                 4U
+static uint32_t    RX_drop[RX_DROP_NUM];
+
+/* Local MAC address */
+static const uint8_t MAC_addr[6] = {
+  ETH_MAC_ADDR0, ETH_MAC_ADDR1, ETH_MAC_ADDR2, ETH_MAC_ADDR3, ETH_MAC_ADDR4, ETH_MAC_ADDR5
+};
+
+/**
+  Update Ethernet MAC address filter from the multicast MAC address table.
+  All multicast frames are accepted when the table is full.
+
+  \return        ARM_DRIVER_OK on success, error code otherwise
+*/
+static int32_t MCast_Update (void) {
+  ARM_ETH_MAC_ADDR addr[ETH_MCAST_NUM + 1U];
+  uint32_t num;
+  uint32_t i;
+  int32_t rval;
+
+  /* All-hosts group (224.0.0.1) for IGMP queries */
+  addr[0].b[0] = 0x01U;
+  addr[0].b[1] = 0x00U;
+  addr[0].b[2] = 0x5EU;
+  addr[0].b[3] = 0x00U;
+  addr[0].b[4] = 0x00U;
+  addr[0].b[5] = 0x01U;
+  num = 1U;
+
+  for (i = 0U; i < ETH_MCAST_NUM; i++) {
+    if (MCast_MAC[i].ref != 0U) {
+      addr[num++] = MCast_MAC[i].addr;
+    }
+  }
+
+  rval = Driver_ETH_MAC->SetAddressFilter (addr, num);
+
+  if ((rval == ARM_DRIVER_OK) && (MAC_ctrl != 0U)) {
+    /* Link is up, reconfigure multicast reception */
+    if (MCast_all != 0U) {
+      rval = Driver_ETH_MAC->Control (ARM_ETH_MAC_CONFIGURE, MAC_ctrl | ARM_ETH_MAC_ADDRESS_MULTICAST);
+    } else {
+      rval = Driver_ETH_MAC->Control (ARM_ETH_MAC_CONFIGURE, MAC_ctrl);
+    }
+  }
+
+  return rval;
+}
+
+/**
+  Add multicast MAC address to the Ethernet MAC address filter.
+
+  \param[in]     pucMACAddress  multicast MAC address
+  \return        0 on success, IOT_SOCKET_ERROR otherwise
+*/
+static int32_t MCast_Add (const uint8_t *pucMACAddress) {
+  uint32_t i, n;
+  int32_t rval;
+
+  if (osMutexAcquire (MCast_mutex, osWaitForever) != osOK) {
+    return IOT_SOCKET_ERROR;
+  }
+
+  n = ETH_MCAST_NUM;
+  for (i = 0U; i < ETH_MCAST_NUM; i++) {
+    if (MCast_MAC[i].ref == 0U) {
+      if (n == ETH_MCAST_NUM) {
+        /* First free entry */
+        n = i;
+      }
+    }
+    else if (memcmp (MCast_MAC[i].addr.b, pucMACAddress, 6U) == 0) {
+      break;
+    }
+  }
+
+  rval = ARM_DRIVER_OK;
+  if (i < ETH_MCAST_NUM) {
+    /* Address already in the filter */
+    if (MCast_MAC[i].ref < 0xFFU) {
+      MCast_MAC[i].ref++;
+    }
+  }
+  else if (n < ETH_MCAST_NUM) {
+    memcpy (MCast_MAC[n].addr.b, pucMACAddress, 6U);
+    MCast_MAC[n].ref = 1U;
+    rval = MCast_Update ();
+  }
+  else {
+    /* Filter is full, accept all multicast frames */
+    MCast_all++;
+    if (MCast_all == 1U) {
+      rval = MCast_Update ();
+    }
+  }
+
+  osMutexRelease (MCast_mutex);
+
+  return (rval == ARM_DRIVER_OK) ? 0 : IOT_SOCKET_ERROR;
+}
+
+/**
+  Remove multicast MAC address from the Ethernet MAC address filter.
+
+  \param[in]     pucMACAddress  multicast MAC address
+  \return        0 on success, IOT_SOCKET_ERROR otherwise
+*/
+static int32_t MCast_Remove (const uint8_t *pucMACAddress) {
+  uint32_t i;
+  int32_t rval;
+
+  if (osMutexAcquire (MCast_mutex, osWaitForever) != osOK) {
+    return IOT_SOCKET_ERROR;
+  }
+
+  for (i = 0U; i < ETH_MCAST_NUM; i++) {
+    if ((MCast_MAC[i].ref != 0U) && (memcmp (MCast_MAC[i].addr.b, pucMACAddress, 6U) == 0)) {
+      break;
+    }
+  }
+
+  rval = ARM_DRIVER_OK;
+  if (i < ETH_MCAST_NUM) {
+    MCast_MAC[i].ref--;
+    if (MCast_MAC[i].ref == 0U) {
+      rval = MCast_Update ();
+    }
+  }
+  else if (MCast_all != 0U) {
+    /* Address was accepted by receiving all multicast frames */
+    MCast_all--;
+    if (MCast_all == 0U) {
+      rval = MCast_Update ();
+    }
+  }
+
+  osMutexRelease (MCast_mutex);
+
+  return (rval == ARM_DRIVER_OK) ? 0 : IOT_SOCKET_ERROR;
+}
+
+/**
+  Set transmit priority of a local port.
+
+  \param[in]     usPort      local TCP or UDP port
+  \param[in]     ucPriority  priority (0 = normal, higher value is sent first)
+  \return        0 on success, IOT_SOCKET_ENOMEM when the priority table is full
+*/
+static int32_t TX_SetPriority (uint16_t usPort, uint8_t ucPriority) {
+  int32_t rval;
+  uint32_t i, n;
+
+  if (osMutexAcquire (TX_mutex, osWaitForever) != osOK) {
+    return IOT_SOCKET_ERROR;
+  }
+
+  n = ETH_TX_PRIO_NUM;
+  for (i = 0U; i < ETH_TX_PRIO_NUM; i++) {
+    if (TX_Prio[i].port == usPort) {
+      break;
+    }
+    if ((TX_Prio[i].port == 0U) && (n == ETH_TX_PRIO_NUM)) {
+      /* First free entry */
+      n = i;
+    }
+  }
+  if (i == ETH_TX_PRIO_NUM) {
+    i = n;
+  }
+
+  rval = 0;
+  if (ucPriority == 0U) {
+    if (i < ETH_TX_PRIO_NUM) {
+      TX_Prio[i].port = 0U;
+    }
+  }
+  else if (i < ETH_TX_PRIO_NUM) {
+    TX_Prio[i].port = usPort;
+    TX_Prio[i].prio = ucPriority;
+  }
+  else {
+    rval = IOT_SOCKET_ENOMEM;
+  }
+
+  osMutexRelease (TX_mutex);
+
+  return rval;
+}
+
+/**
+  Get transmit priority of a local port.
+
+  \param[in]     usPort      local TCP or UDP port
+  \return        priority (0 = normal)
+*/
+static int32_t TX_GetPriority (uint16_t usPort) {
+  uint8_t prio;
+  uint32_t i;
+
+  prio = 0U;
+  if (osMutexAcquire (TX_mutex, osWaitForever) == osOK) {
+    for (i = 0U; i < ETH_TX_PRIO_NUM; i++) {
+      if ((TX_Prio[i].port != 0U) && (TX_Prio[i].port == usPort)) {
+        prio = TX_Prio[i].prio;
+        break;
+      }
+    }
+    osMutexRelease (TX_mutex);
+  }
+
+  return (int32_t)prio;
+}
+
+/**
+  Extend the system timer count to 64 bits.
+  Must be called at least once per system timer period.
+
+  \return        system timer count
+*/
+static uint64_t TS_Update (void) {
+  uint64_t count;
+  uint32_t now;
+  int32_t lock;
+
+  lock = osKernelLock ();
+  now       = osKernelGetSysTimerCount ();
+  TS_count += (uint32_t)(now - TS_last);
+  TS_last   = now;
+  count     = TS_count;
+  (void)osKernelRestoreLock (lock);
+
+  return count;
+}
+
+/**
+  Read the system timer as timestamp.
+
+  \param[out]    time  current time
+*/
+static void TS_Software (ARM_ETH_MAC_TIME *time) {
+  uint64_t count;
+  uint32_t freq;
+
+  count = TS_Update ();
+  freq  = osKernelGetSysTimerFreq ();
+
+  time->sec = (uint32_t)(count / freq);
+  time->ns  = (uint32_t)(((count % freq) * 1000000000U) / freq);
+}
+
+/**
+  Store the receive timestamp of a network buffer.
+
+  \param[in]     pxBuffer  network buffer receiving the frame
+  \param[in]     hw        0 = system timer, Ethernet MAC receive time when available otherwise
+*/
+static void RX_Stamp (const NetworkBufferDescriptor_t *pxBuffer, uint32_t hw) {
+  uint32_t i;
+
+  i = RX_TS_INDEX (pxBuffer);
+
+  RX_Ts[i].buf = pxBuffer;
+  RX_Ts[i].hw  = 0U;
+  if ((hw != 0U) && (TS_hw != 0U)) {
+    /* Must be read before the frame */
+    if (Driver_ETH_MAC->GetRxFrameTime (&RX_Ts[i].time) == ARM_DRIVER_OK) {
+      RX_Ts[i].hw = 1U;
+    }
+  }
+  if (RX_Ts[i].hw == 0U) {
+    TS_Software (&RX_Ts[i].time);
+  }
+}
+
+/**
+  Get receive timestamp of a network buffer.
+
+  \param[in]     frame  network buffer descriptor passed to the TCP/IP stack
+  \param[out]    ts     receive timestamp
+  \return        0 on success, IOT_SOCKET_EINVAL when the buffer was not received by the interface
+*/
+static int32_t RX_GetTimestamp (const void *frame, iotSocketTimestamp_t *ts) {
+  const NetworkBufferDescriptor_t *pxBuffer = frame;
+  uint32_t i;
+
+  i = RX_TS_INDEX (pxBuffer);
+  if ((pxBuffer == NULL) || (RX_Ts[i].buf != pxBuffer)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  ts->sec  = RX_Ts[i].time.sec;
+  ts->nsec = RX_Ts[i].time.ns;
+  ts->hw   = RX_Ts[i].hw;
+
+  return 0;
+}
+
+/**
+  Enable or disable transmit timestamping of a local port.
+
+  \param[in]     usPort   local UDP port
+  \param[in]     enable   0 = disable, enable otherwise
+  \return        0 on success, IOT_SOCKET_ENOMEM when the timestamp table is full
+*/
+static int32_t TX_SetTimestamp (uint16_t usPort, uint32_t enable) {
+  int32_t rval;
+  uint32_t i, n;
+
+  if (osMutexAcquire (TX_mutex, osWaitForever) != osOK) {
+    return IOT_SOCKET_ERROR;
+  }
+
+  n = ETH_TX_TS_NUM;
+  for (i = 0U; i < ETH_TX_TS_NUM; i++) {
+    if (TX_Ts[i].port == usPort) {
+      break;
+    }
+    if ((TX_Ts[i].port == 0U) && (n == ETH_TX_TS_NUM)) {
+      /* First free entry */
+      n = i;
+    }
+  }
+
+  rval = 0;
+  if (enable == 0U) {
+    if (i < ETH_TX_TS_NUM) {
+      if (TX_ts_wait == (i + 1U)) {
+        /* Discard the pending MAC timestamp */
+        TX_ts_wait = 0U;
+      }
+      TX_Ts[i].port = 0U;
+      TX_ts_num--;
+    }
+  }
+  else if (i < ETH_TX_TS_NUM) {
+    /* Already enabled, restart */
+    TX_Ts[i].valid = 0U;
+  }
+  else if (n < ETH_TX_TS_NUM) {
+    TX_Ts[n].port  = usPort;
+    TX_Ts[n].valid = 0U;
+    TX_ts_num++;
+  }
+  else {
+    rval = IOT_SOCKET_ENOMEM;
+  }
+
+  osMutexRelease (TX_mutex);
+
+  return rval;
+}
+
+/**
+  Get transmit timestamp of the last frame sent from a local port.
+
+  \param[in]     usPort   local UDP port
+  \param[out]    ts       transmit timestamp
+  \return        0 on success, IOT_SOCKET_EAGAIN when no frame was timestamped
+*/
+static int32_t TX_GetTimestamp (uint16_t usPort, iotSocketTimestamp_t *ts) {
+  int32_t rval;
+  uint32_t i;
+
+  rval = IOT_SOCKET_EAGAIN;
+  if (osMutexAcquire (TX_mutex, osWaitForever) == osOK) {
+    for (i = 0U; i < ETH_TX_TS_NUM; i++) {
+      if ((TX_Ts[i].port != 0U) && (TX_Ts[i].port == usPort)) {
+        if (TX_Ts[i].valid != 0U) {
+          ts->sec  = TX_Ts[i].time.sec;
+          ts->nsec = TX_Ts[i].time.ns;
+          ts->hw   = TX_Ts[i].hw;
+          rval = 0;
+        }
+        break;
+      }
+    }
+    osMutexRelease (TX_mutex);
+  }
+
+  return rval;
+}
+
+/**
+  Determine the local port of an Ethernet frame.
+
+  \param[in]     frame  Ethernet frame
+  \param[in]     len    frame length
+  \return        local port of an IPv4 frame carrying TCP or UDP, 0 otherwise
+*/
+static uint16_t TX_Port (const uint8_t *frame, uint32_t len) {
+  uint32_t hlen;
+
+  /* IPv4 frame carrying TCP or UDP */
+  if ((len < 34U) || (frame[12] != 0x08U) || (frame[13] != 0x00U)) {
+    return 0U;
+  }
+  if ((frame[23] != 6U) && (frame[23] != 17U)) {
+    return 0U;
+  }
+  hlen = (frame[14] & 0x0FU) * 4U;
+  if (len < (14U + hlen + 2U)) {
+    return 0U;
+  }
+
+  /* Source port is the local port */
+  return (uint16_t)((frame[14U + hlen] << 8) | frame[15U + hlen]);
+}
+
+/**
+  Determine transmit priority of an Ethernet frame from its local port.
+
+  \param[in]     frame  Ethernet frame
+  \param[in]     len    frame length
+  \return        priority (0 = normal)
+*/
+static uint8_t TX_Priority (const uint8_t *frame, uint32_t len) {
+  uint16_t port;
+  uint32_t i;
+
+  port = TX_Port (frame, len);
+  if (port == 0U) {
+    return 0U;
+  }
+
+  for (i = 0U; i < ETH_TX_PRIO_NUM; i++) {
+    if ((TX_Prio[i].port != 0U) && (TX_Prio[i].port == port)) {
+      return TX_Prio[i].prio;
+    }
+  }
+  return 0U;
+}
+
+/**
+  Take the transmit timestamp of an Ethernet frame sent from a timestamped UDP port.
+  Must be called with TX_mutex acquired.
+
+  \param[in]     frame  Ethernet frame
+  \param[in]     len    frame length
+  \param[in]     hw     0 = system timer, Ethernet MAC timestamp when available otherwise
+  \return        SendFrame flags requesting the Ethernet MAC timestamp, 0 otherwise
+*/
+static uint32_t TX_Stamp (const uint8_t *frame, uint32_t len, uint32_t hw) {
+  uint16_t port;
+  uint32_t i;
+
+  if (TX_ts_num == 0U) {
+    return 0U;
+  }
+
+  port = TX_Port (frame, len);
+  if ((port == 0U) || (frame[23] != 17U)) {
+    return 0U;
+  }
+  for (i = 0U; i < ETH_TX_TS_NUM; i++) {
+    if (TX_Ts[i].port == port) {
+      break;
+    }
+  }
+  if (i == ETH_TX_TS_NUM) {
+    return 0U;
+  }
+
+  if ((hw != 0U) && (TS_hw != 0U) && (TX_ts_wait == 0U)) {
+    /* Timestamp is read when the transmission is complete */
+    TX_ts_wait = i + 1U;
+    TX_ts_tick = osKernelGetTickCount ();
+    return (ARM_ETH_MAC_TX_FRAME_TIMESTAMP | ARM_ETH_MAC_TX_FRAME_EVENT);
+  }
+
+  TS_Software (&TX_Ts[i].time);
+  TX_Ts[i].hw    = 0U;
+  TX_Ts[i].valid = 1U;
+
+  return 0U;
+}
+
+/**
+  Read the Ethernet MAC timestamp of the last timestamped transmission.
+  Must be called with TX_mutex acquired.
+*/
+static void TX_StampDone (void) {
+  ARM_ETH_MAC_TIME time;
+  int32_t rval;
+  uint32_t i;
+
+  if (TX_ts_wait == 0U) {
+    return;
+  }
+  i = TX_ts_wait - 1U;
+
+  rval = Driver_ETH_MAC->GetTxFrameTime (&time);
+
+  if (rval == ARM_DRIVER_ERROR_BUSY) {
+    if ((osKernelGetTickCount () - TX_ts_tick) < (osKernelGetTickFreq () / 100U)) {
+      /* Frame not sent yet, retry for 10ms */
+      return;
+    }
+    /* Timestamp lost */
+  }
+  else if (rval == ARM_DRIVER_OK) {
+    TX_Ts[i].time  = time;
+    TX_Ts[i].hw    = 1U;
+    TX_Ts[i].valid = 1U;
+  }
+  else {
+    if (rval == ARM_DRIVER_ERROR_UNSUPPORTED) {
+      /* Use the system timer from now on */
+      TS_hw = 0U;
+    }
+    TS_Software (&TX_Ts[i].time);
+    TX_Ts[i].hw    = 0U;
+    TX_Ts[i].valid = 1U;
+  }
+  TX_ts_wait = 0U;
+}
+
+/**
+  Send an Ethernet frame and take its transmit timestamp.
+  Must be called with TX_mutex acquired.
+
+  \param[in]     frame  Ethernet frame
+  \param[in]     len    frame length
+  \param[in]     flags  SendFrame flags
+  \return        ARM_DRIVER_OK on success, error code otherwise
+*/
+static int32_t TX_Send (const uint8_t *frame, uint32_t len, uint32_t flags) {
+  uint32_t ts;
+  int32_t rval;
+
+  ts = TX_Stamp (frame, len, 1U);
+
+  rval = Driver_ETH_MAC->SendFrame (frame, len, flags | ts);
+
+  if ((rval != ARM_DRIVER_OK) && (ts != 0U)) {
+    /* Frame not sent, no timestamp to read */
+    TX_ts_wait = 0U;
+  }
+
+  return rval;
+}
+
+/**
+  Determine checksums carried by an Ethernet frame.
+
+  \param[in]     frame  Ethernet frame
+  \param[in]     len    frame length
+  \return        checksums (CKS_xxx), 0 when the frame is not an IP frame
+*/
+static uint32_t CKS_Frame (const uint8_t *frame, uint32_t len) {
+  uint32_t cks;
+  uint8_t proto;
+
+  if ((len >= 34U) && (frame[12] == 0x08U) && (frame[13] == 0x00U)) {
+    cks   = CKS_IP4;
+    proto = frame[23];
+  } else if ((len >= 54U) && (frame[12] == 0x86U) && (frame[13] == 0xDDU)) {
+    cks   = CKS_IP6;
+    proto = frame[20];
+  } else {
+    return 0U;
+  }
+
+  switch (proto) {
+    case 1U:
+    case 58U:
+      /* ICMP, ICMPv6 */
+      cks |= CKS_ICMP;
+      break;
+    case 6U:
+      cks |= CKS_TCP;
+      break;
+    case 17U:
+      cks |= CKS_UDP;
+      break;
+    default:
+      break;
+  }
+  return cks;
+}
+
+/**
+  Verify checksums of a received frame not verified by the Ethernet MAC.
+
+  \param[in]     frame  Ethernet frame
+  \param[in]     len    frame length
+  \return        pdTRUE when checksums are correct, pdFALSE otherwise
+*/
+static BaseType_t CKS_Verify (uint8_t *frame, uint32_t len) {
+  uint32_t all;
+  uint32_t cks;
+
+  all = CKS_Frame (frame, len);
+  cks = all & ~CKS_rx;
+  if (cks == 0U) {
+    return pdTRUE;
+  }
+
+  if ((cks & CKS_IP4) != 0U) {
+    /* IPv4 header checksum */
+    if (usGenerateChecksum (0U, &frame[14], (frame[14] & 0x0FU) * 4U) != ipCORRECT_CRC) {
+      return pdFALSE;
+    }
+  }
+
+  /* Protocol checksum, IPv6 frames also require IPv6 offload */
+  if (((all & CKS_PROTO) != 0U) && ((cks & (CKS_PROTO | CKS_IP6)) != 0U)) {
+    if (usGenerateProtocolChecksum (frame, len, pdFALSE) != ipCORRECT_CRC) {
+      return pdFALSE;
+    }
+  }
+  return pdTRUE;
+}
+
+/**
+  Insert checksums of a transmitted frame not calculated by the Ethernet MAC.
+
+  \param[in]     frame  Ethernet frame
+  \param[in]     len    frame length
+*/
+static void CKS_Insert (uint8_t *frame, uint32_t len) {
+  uint32_t all;
+  uint32_t cks;
+  uint16_t sum;
+
+  all = CKS_Frame (frame, len);
+  cks = all & ~CKS_tx;
+  if (cks == 0U) {
+    return;
+  }
+
+  if ((cks & CKS_IP4) != 0U) {
+    /* IPv4 header checksum */
+    frame[24] = 0U;
+    frame[25] = 0U;
+    sum = (uint16_t)~usGenerateChecksum (0U, &frame[14], (frame[14] & 0x0FU) * 4U);
+    frame[24] = (uint8_t)(sum >> 8);
+    frame[25] = (uint8_t)(sum);
+  }
+
+  /* Protocol checksum, IPv6 frames also require IPv6 offload */
+  if (((all & CKS_PROTO) != 0U) && ((cks & (CKS_PROTO | CKS_IP6)) != 0U)) {
+    (void)usGenerateProtocolChecksum (frame, len, pdTRUE);
+  }
+}
+
+/**
+  Send queued frames, highest priority first, until the transmitter is busy.
+  Must be called with TX_mutex acquired.
+*/
+static void TX_Flush (void) {
+  NetworkBufferDescriptor_t *pxBuffer;
+  uint32_t sent;
+  int32_t rval;
+  uint32_t i;
+
+  sent = 0U;
+  while (TX_count != 0U) {
+    pxBuffer = TX_Queue[0].buf;
+
+    rval = TX_Send (pxBuffer->pucEthernetBuffer, pxBuffer->xDataLength, TX_event);
+
+    if (rval == ARM_DRIVER_ERROR_BUSY) {
+      /* Transmitter is busy, keep the frame */
+      break;
+    }
+    if (rval == ARM_DRIVER_OK) {
+      iptraceNETWORK_INTERFACE_TRANSMIT();
+    }
+
+    /* Frame is copied by the driver (or dropped on error) */
+    vReleaseNetworkBufferAndDescriptor (pxBuffer);
+
+    TX_count--;
+    for (i = 0U; i < TX_count; i++) {
+      TX_Queue[i] = TX_Queue[i + 1U];
+    }
+    sent++;
+  }
+
+  if (sent != 0U) {
+    /* Wake up threads waiting for space in the queue */
+    osEventFlagsSet (TX_evt, 0x0001U);
+  }
+}
+
+/**
+  Check if the transmit path has pending work (queued frames or a transmit timestamp to read).
+*/
+static uint32_t TX_Pending (void) {
+  return (TX_count + TX_ts_wait);
+}
+
+/**
+  Filter a received frame before it is passed to the TCP/IP stack.
+
+  \param[in]     pxBuffer  network buffer containing the frame
+  \return        drop reason (RX_DROP_xxx), RX_DROP_NUM when the frame is accepted
+*/
+static uint32_t RX_Filter (NetworkBufferDescriptor_t *pxBuffer) {
+  uint8_t *frame;
+  uint32_t len;
+  uint16_t type;
+
+  frame = pxBuffer->pucEthernetBuffer;
+  len   = pxBuffer->xDataLength;
+
+  if (len < 14U) {
+    return RX_DROP_TYPE;
+  }
+
+  /* Destination address, multicast groups are selected by the Ethernet MAC address filter */
+  if ((frame[0] & 0x01U) == 0U) {
+    if (memcmp (frame, MAC_addr, 6U) != 0) {
+      /* Unicast to another host */
+      return RX_DROP_ADDR;
+    }
+  }
+  else if ((frame[0] & frame[1] & frame[2] & frame[3] & frame[4] & frame[5]) == 0xFFU) {
+#if (ETH_RX_BROADCAST == 0)
+    return RX_DROP_ADDR;
+#endif
+  }
+
+  type = (uint16_t)((frame[12] << 8) | frame[13]);
 
-/* If ipconfigETHERNET_DRIVER_FILTERS_FRAME_TYPES is set to 1, then the Ethernet
- * driver will filter incoming packets and only pass the stack those packets it
- * considers need processing. */
-#if (ipconfigETHERNET_DRIVER_FILTERS_FRAME_TYPES == 0)
-    #define ipCONSIDER_FRAME_FOR_PROCESSING(pucEthernetBuffer)    eProcessBuffer
-#else
-    #define ipCONSIDER_FRAME_FOR_PROCESSING(pucEthernetBuffer)    eConsiderFrameForProcessing((pucEthernetBuffer))
+#if (ETH_VLAN_FILTER != 0)
+  if (type == 0x8100U) {
+    /* VLAN tagged frame */
+    if ((len < 18U) || ((((frame[14] & 0x0FU) << 8) | frame[15]) != ETH_VLAN_ID)) {
+      return RX_DROP_TYPE;
+    }
+
+    /* Remove VLAN tag */
+    memmove (&frame[12], &frame[16], len - 16U);
+    len -= 4U;
+    pxBuffer->xDataLength = len;
+
+    type = (uint16_t)((frame[12] << 8) | frame[13]);
+  }
 #endif
 
-/* Reference to the underlying Ethernet MAC driver */
-#define _ARM_Driver_ETH_MAC_(n)           Driver_ETH_MAC##n
-#define  ARM_Driver_ETH_MAC_(n)      _ARM_Driver_ETH_MAC_(n)
+  /* Frame types handled by the TCP/IP stack: IPv4, ARP, IPv6 */
+  if ((type != 0x0800U) && (type != 0x0806U) && (type != 0x86DDU)) {
+    return RX_DROP_TYPE;
+  }
 
-extern ARM_DRIVER_ETH_MAC             ARM_Driver_ETH_MAC_(ETH_DRV_NUM);
-#define Driver_ETH_MAC              (&ARM_Driver_ETH_MAC_(ETH_DRV_NUM))
+  if (CKS_Verify (frame, len) != pdTRUE) {
+    return RX_DROP_CKSUM;
+  }
 
-extern ARM_DRIVER_ETH_PHY             ARM_Driver_ETH_PHY_(ETH_PHY_NUM);
-#define Driver_ETH_PHY              (&ARM_Driver_ETH_PHY_(ETH_PHY_NUM))
+  return RX_DROP_NUM;
+}
 
-static const osThreadAttr_t ETH_Thread_attr = {
-  .name       = "ETH_Thread",
-  .priority   = osPriorityHigh,
-  .stack_size = 512U
-};
+/**
+  Read the next received frame into a newly allocated network buffer.
 
-osThreadId_t ETH_tid;
+  \param[out]    ppxBuffer  network buffer containing the frame (NULL when dropped)
+  \return        size of the frame, 0 when no frame is pending
+*/
+static uint32_t RX_Copy (NetworkBufferDescriptor_t **ppxBuffer) {
+  NetworkBufferDescriptor_t *pxBuffer;
+  uint32_t size;
+
+  *ppxBuffer = NULL;
+
+  /* Determine the size of received frame */
+  size = Driver_ETH_MAC->GetRxFrameSize();
+  if (size == 0U) {
+    return 0U;
+  }
+
+  /* Allocate a network buffer descriptor */
+  pxBuffer = pxGetNetworkBufferWithDescriptor (size, 0U);
+
+  if (pxBuffer != NULL) {
+    /* Set the size of the frame we intend to receive */
+    pxBuffer->xDataLength = size;
+
+    /* Timestamp of received frame */
+    RX_Stamp (pxBuffer, 1U);
+
+    /* Get received frame */
+    if (Driver_ETH_MAC->ReadFrame (pxBuffer->pucEthernetBuffer, size) > 0) {
+      *ppxBuffer = pxBuffer;
+      return size;
+    }
+
+    /* Release allocated buffer */
+    vReleaseNetworkBufferAndDescriptor (pxBuffer);
+  }
+  RX_drop[RX_DROP_NOBUF]++;
+
+  /* Dump received frame */
+  Driver_ETH_MAC->ReadFrame (NULL, 0U);
+
+  return size;
+}
 
 /**
-  Callback function that signals an Ethernet Event from CMSIS-Driver Ethernet MAC.
+  Send the collected receive batch to the TCP/IP stack in one event.
+*/
+static void RX_Send (void) {
+  NetworkBufferDescriptor_t *pxBuffer;
+  IPStackEvent_t xRxEvent;
+  uint32_t bin;
 
-  \param[in]     event  event notification mask
-  \return        none
+  if (RX_batch == 0U) {
+    return;
+  }
+
+  xRxEvent.eEventType = eNetworkRxEvent;
+  xRxEvent.pvData     = (void *)RX_head;
+
+  if (xSendEventStructToIPTask (&xRxEvent, 0U) == pdTRUE) {
+    iptraceNETWORK_INTERFACE_RECEIVE();
+
+    /* Batch size distribution */
+    for (bin = 0U; (bin < (ETH_RX_BATCH_BINS - 1U)) && ((RX_batch >> (bin + 1U)) != 0U); bin++);
+    RX_batch_hist[bin]++;
+  }
+  else {
+    /* The buffers could not be sent to the TCP/IP stack */
+    iptraceETHERNET_RX_EVENT_LOST();
+    RX_drop[RX_DROP_NOBUF] += RX_batch;
+
+    while (RX_head != NULL) {
+      pxBuffer = RX_head;
+#if (ipconfigUSE_LINKED_RX_MESSAGES != 0)
+      RX_head  = pxBuffer->pxNextBuffer;
+#else
+      RX_head  = NULL;
+#endif
+      vReleaseNetworkBufferAndDescriptor (pxBuffer);
+    }
+  }
+
+  RX_head  = NULL;
+  RX_tail  = NULL;
+  RX_batch = 0U;
+}
+
+/**
+  Add a received frame to the batch for the TCP/IP stack.
+
+  \param[in]     pxBuffer  network buffer containing the frame
 */
-void ETH_MAC_SignalEvent (uint32_t event) {
+static void RX_Queue (NetworkBufferDescriptor_t *pxBuffer) {
 
-  if (event & ARM_ETH_MAC_EVENT_RX_FRAME) {
-    /* Frame received, wake up the worker thread */
-    osThreadFlagsSet (ETH_tid, 0x0001);
+  /* Check if the received Ethernet frame needs to be processed */
+  if (ipCONSIDER_FRAME_FOR_PROCESSING (pxBuffer->pucEthernetBuffer) != eProcessBuffer) {
+    RX_drop[RX_DROP_TYPE]++;
+    vReleaseNetworkBufferAndDescriptor (pxBuffer);
+    return;
+  }
+
+#if (ipconfigUSE_LINKED_RX_MESSAGES != 0)
+  /* Chain frames into one event */
+  pxBuffer->pxNextBuffer = NULL;
+  if (RX_head == NULL) {
+    RX_head = pxBuffer;
+  } else {
+    RX_tail->pxNextBuffer = pxBuffer;
   }
+  RX_tail = pxBuffer;
+  RX_batch++;
+
+  if (RX_batch >= ETH_RX_BATCH_LEN) {
+    RX_Send ();
+  }
+#else
+  /* One event per frame */
+  RX_head  = pxBuffer;
+  RX_tail  = pxBuffer;
+  RX_batch = 1U;
+  RX_Send ();
+#endif
 }
 
 /**
-  Thread that processes incoming frames
+  Check Ethernet link state and reconfigure the MAC when the link
+  comes up or its speed or duplex mode changes.
 */
-static void ETH_Thread (void *arg) {
+static void LINK_Check (void) {
   ARM_ETH_LINK_STATE link_state;
   ARM_ETH_LINK_INFO  link_info;
+  uint32_t link_up;
   uint32_t ctrl;
-  uint32_t size;
-  NetworkBufferDescriptor_t *pxBufferDescriptor;
-  IPStackEvent_t xRxEvent;
   int32_t rval;
-  uint32_t dump_frame;
-  uint32_t dump_fbuf;
 
-  (void)arg;
+  link_state = Driver_ETH_PHY->GetLinkState();
 
-  /* Check Ethernet link state */
-  do {
-    link_state = Driver_ETH_PHY->GetLinkState();
-
-    if (link_state == ARM_ETH_LINK_UP) {
-      /* Get Ethernet PHY device link info */
-      link_info = Driver_ETH_PHY->GetLinkInfo();
-      
-      if (link_info.duplex == 0U) {
-        /* Half duplex */
-        ctrl = ARM_ETH_MAC_DUPLEX_HALF;
-      } else {
-        /* Full duplex */
-        ctrl = ARM_ETH_MAC_DUPLEX_FULL;
-      }
-      
-      if (link_info.speed == 0) {
-        /* 10Mbit link */
-        ctrl |= ARM_ETH_MAC_SPEED_10M;
-      } else if (link_info.speed == 1) {
-        /* 100Mbit link */
-        ctrl |= ARM_ETH_MAC_SPEED_100M;
-      } else {
-        /* 1Gbit link */
-        ctrl |= ARM_ETH_MAC_SPEED_1G;
-      }
+  if (link_state == ARM_ETH_LINK_UP) {
+    /* Get Ethernet PHY device link info */
+    link_info = Driver_ETH_PHY->GetLinkInfo();
+
+    if ((LINK_state == ARM_ETH_LINK_UP) &&
+        (link_info.speed  == LINK_info.speed) &&
+        (link_info.duplex == LINK_info.duplex)) {
+      /* No change */
+      return;
+    }
+
+    if (link_info.duplex == 0U) {
+      /* Half duplex */
+      ctrl = ARM_ETH_MAC_DUPLEX_HALF;
+    } else {
+      /* Full duplex */
+      ctrl = ARM_ETH_MAC_DUPLEX_FULL;
+    }
+
+    if (link_info.speed == 0) {
+      /* 10Mbit link */
+      ctrl |= ARM_ETH_MAC_SPEED_10M;
+    } else if (link_info.speed == 1) {
+      /* 100Mbit link */
+      ctrl |= ARM_ETH_MAC_SPEED_100M;
+    } else {
+      /* 1Gbit link */
+      ctrl |= ARM_ETH_MAC_SPEED_1G;
+    }
+
+#if (ETH_RX_BROADCAST != 0)
+    /* Receive broadcast frames */
+    ctrl |= ARM_ETH_MAC_ADDRESS_BROADCAST;
+#endif
+
+    /* Enable checksum offload supported by the MAC */
+    if (CKS_rx != 0U) {
+      ctrl |= ARM_ETH_MAC_CHECKSUM_OFFLOAD_RX;
+    }
+    if (CKS_tx != 0U) {
+      ctrl |= ARM_ETH_MAC_CHECKSUM_OFFLOAD_TX;
+    }
 
-      /* Configure Ethernet MAC interface */
+    /* Configure Ethernet MAC interface */
+    osMutexAcquire (MCast_mutex, osWaitForever);
+    if (MCast_all != 0U) {
+      rval = Driver_ETH_MAC->Control (ARM_ETH_MAC_CONFIGURE, ctrl | ARM_ETH_MAC_ADDRESS_MULTICAST);
+    } else {
       rval = Driver_ETH_MAC->Control (ARM_ETH_MAC_CONFIGURE, ctrl);
+    }
+    MAC_ctrl = ctrl;
+    osMutexRelease (MCast_mutex);
 
-      if (rval == ARM_DRIVER_OK) {
-        /* Enable transmitter and receiver */
-        Driver_ETH_MAC->Control (ARM_ETH_MAC_CONTROL_TX, 1U);
-        Driver_ETH_MAC->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+    if (rval == ARM_DRIVER_OK) {
+      /* Enable transmitter and receiver */
+      Driver_ETH_MAC->Control (ARM_ETH_MAC_CONTROL_TX, 1U);
+      Driver_ETH_MAC->Control (ARM_ETH_MAC_CONTROL_RX, 1U);
+
+      link_up    = (LINK_state != ARM_ETH_LINK_UP) ? 1U : 0U;
+      LINK_info  = link_info;
+      LINK_state = ARM_ETH_LINK_UP;
+
+      if ((link_up != 0U) && (LINK_hook != NULL)) {
+        LINK_hook (pdTRUE);
+      }
+
+      if ((link_up != 0U) && (LINK_wait != 0U)) {
+        /* IP task waits for the link, reinitialize now instead of after the retry delay */
+        LINK_wait = 0U;
+        FreeRTOS_NetworkDown ();
       }
     }
-    else {
-      /* Wait a bit */
-      osDelay(100);
+  }
+  else if (LINK_state == ARM_ETH_LINK_UP) {
+    /* Link lost, disable transmitter and receiver */
+    Driver_ETH_MAC->Control (ARM_ETH_MAC_CONTROL_TX, 0U);
+    Driver_ETH_MAC->Control (ARM_ETH_MAC_CONTROL_RX, 0U);
+
+    LINK_state = ARM_ETH_LINK_DOWN;
+
+    if (LINK_hook != NULL) {
+      LINK_hook (pdFALSE);
     }
 
-  } while (link_state == ARM_ETH_LINK_DOWN);
-  
+    /* TCP/IP stack reinitializes the interface until the link is up again */
+    FreeRTOS_NetworkDown ();
+  }
+}
+
+/**
+  Register function called by the Ethernet thread when the link goes up or down.
 
-  for (;;) {
-    osThreadFlagsWait (0x0001, osFlagsWaitAny, osWaitForever);
+  \param[in]     pxHook  callback function, xLinkUp is pdTRUE when the link is up (NULL = none)
+*/
+void vNetworkInterfaceSetLinkHook (void (*pxHook) (BaseType_t xLinkUp)) {
+  LINK_hook = pxHook;
+}
 
-    do {
-      /* Determine the size of received frame */
-      size = Driver_ETH_MAC->GetRxFrameSize();
+/**
+  Get current Ethernet link state.
 
-      if (size > 0U) {
-        dump_frame = 1U;
-        dump_fbuf  = 1U;
+  \param[out]    pulSpeed   link speed in Mbit/s, 0 when link is down (NULL = not requested)
+  \param[out]    pulDuplex  duplex mode: 1 = full, 0 = half (NULL = not requested)
+  \return        pdTRUE when link is up, pdFALSE otherwise
+*/
+BaseType_t xNetworkInterfaceGetLinkState (uint32_t *pulSpeed, uint32_t *pulDuplex) {
+  ARM_ETH_LINK_INFO link_info;
+  uint32_t speed;
 
-        /* Allocate a network buffer descriptor */
-        pxBufferDescriptor = pxGetNetworkBufferWithDescriptor (size, 0U);
+  link_info = LINK_info;
+  if (LINK_state != ARM_ETH_LINK_UP) {
+    if (pulSpeed != NULL) {
+      *pulSpeed = 0U;
+    }
+    if (pulDuplex != NULL) {
+      *pulDuplex = 0U;
+    }
+    return pdFALSE;
+  }
 
-        if (pxBufferDescriptor != NULL) {
-          /* Set the size of the frame we intend to receive */
-          pxBufferDescriptor->xDataLength = size;
+  if (link_info.speed == 0) {
+    speed = 10U;
+  } else if (link_info.speed == 1) {
+    speed = 100U;
+  } else {
+    speed = 1000U;
+  }
 
-          /* Get received frame */
-          rval = Driver_ETH_MAC->ReadFrame (pxBufferDescriptor->pucEthernetBuffer, size);
+  if (pulSpeed != NULL) {
+    *pulSpeed = speed;
+  }
+  if (pulDuplex != NULL) {
+    *pulDuplex = link_info.duplex;
+  }
+  return pdTRUE;
+}
 
-          if (rval > 0U) {
-            dump_frame = 0U;
+/**
+  Get receive drop counters.
 
-            /* Check if the received Ethernet frame needs to be processed */
-            if(eConsiderFrameForProcessing (pxBufferDescriptor->pucEthernetBuffer) == eProcessBuffer) {
-              /* Frame is good, sent Rx event to the TCP/IP stack */
-              xRxEvent.eEventType = eNetworkRxEvent;
+  \param[out]    pulCount  array receiving the number of dropped frames:
+                           [0] destination address not accepted,
+                           [1] frame type or VLAN not accepted,
+                           [2] invalid checksum,
+                           [3] no network buffer or TCP/IP stack busy
+  \param[in]     ulCount   number of elements in pulCount
+  \return        number of elements stored
+*/
+uint32_t ulNetworkInterfaceGetRxDrops (uint32_t *pulCount, uint32_t ulCount) {
+  uint32_t i;
 
-              /* Set data pointer to the network buffer descriptor data */
-              xRxEvent.pvData = (void *)pxBufferDescriptor;
+  if (ulCount > RX_DROP_NUM) {
+    ulCount = RX_DROP_NUM;
+  }
+  for (i = 0U; i < ulCount; i++) {
+    pulCount[i] = RX_drop[i];
+  }
 
-              if (xSendEventStructToIPTask (&xRxEvent, 0U) == pdTRUE) {
-                /* Event was successfully sent */
-                dump_fbuf  = 0U;
+  return ulCount;
+}
 
-                iptraceNETWORK_INTERFACE_RECEIVE();
-              } else {
-                /* The buffer could not be sent to the TCP/IP stack */
-                iptraceETHERNET_RX_EVENT_LOST();
-              }
-            }
-          }
-        }
+/**
+  Get receive batch size distribution.
 
-        if (dump_frame != 0U) {
-          /* Dump received frame */
-          Driver_ETH_MAC->ReadFrame (NULL, 0U);
-        }
-        if (dump_fbuf != 0U) {
-          /* Release allocated buffer */
-          if (pxBufferDescriptor != NULL) {
-            vReleaseNetworkBufferAndDescriptor (pxBufferDescriptor);
-          }
+  \param[out]    pulHistogram  array where element n receives the number of receive events
+                               carrying 2^n to 2^(n+1)-1 frames (last element: 2^n or more)
+  \param[in]     ulCount       number of elements in pulHistogram
+  \return        number of elements stored
+*/
+uint32_t ulNetworkInterfaceGetRxBatchStats (uint32_t *pulHistogram, uint32_t ulCount) {
+  uint32_t i;
+
+  if (ulCount > ETH_RX_BATCH_BINS) {
+    ulCount = ETH_RX_BATCH_BINS;
+  }
+  for (i = 0U; i < ulCount; i++) {
+    pulHistogram[i] = RX_batch_hist[i];
+  }
+
+  return ulCount;
+}
+
+#if (ETH_RX_MODERATION != 0)
+/**
+  Switch between event driven and polled reception depending on the receive rate.
+
+  \param[in]     num   number of frames received in the last wakeup
+*/
+static void RX_Moderate (uint32_t num) {
+  uint32_t freq;
+  uint32_t tick;
+  uint32_t elapsed;
+
+  freq = osKernelGetTickFreq ();
+  tick = osKernelGetTickCount ();
+
+  RX_rate_num += num;
+  elapsed = tick - RX_rate_tick;
+  if (elapsed >= ((ETH_RX_RATE_PERIOD * freq) / 1000U)) {
+    RX_rate      = (uint32_t)(((uint64_t)RX_rate_num * freq) / elapsed);
+    RX_rate_num  = 0U;
+    RX_rate_tick = tick;
+  }
+
+  if (RX_poll == 0U) {
+    if (RX_rate >= ETH_RX_POLL_RATE) {
+      /* High receive rate, stop waking up on every received frame */
+      RX_poll_tick = tick;
+      RX_poll      = 1U;
+    }
+  }
+  else if (num != 0U) {
+    RX_poll_tick = tick;
+  }
+  else if ((tick - RX_poll_tick) >= ((ETH_RX_POLL_WINDOW * freq) / 1000U)) {
+    /* No frames during the poll window, wake up on received frames again */
+    RX_poll = 0U;
+    RX_rate = 0U;
+
+    /* Check for a frame received before events were enabled */
+    osThreadFlagsSet (ETH_tid, 0x0001);
+  }
+}
+#endif
+
+/**
+  Callback function that signals an Ethernet Event from CMSIS-Driver Ethernet MAC.
+
+  \param[in]     event  event notification mask
+  \return        none
+*/
+void ETH_MAC_SignalEvent (uint32_t event) {
+
+  if ((event & ARM_ETH_MAC_EVENT_RX_FRAME) && (RX_poll == 0U)) {
+    /* Frame received, wake up the worker thread unless it is polling */
+    osThreadFlagsSet (ETH_tid, 0x0001);
+  }
+  if (event & ARM_ETH_MAC_EVENT_TX_FRAME) {
+    /* Frame sent, wake up the worker thread to send queued frames and read the timestamp */
+    osThreadFlagsSet (ETH_tid, 0x0002);
+  }
+}
+
+/**
+  Thread that processes incoming frames
+*/
+static void ETH_Thread (void *arg) {
+  uint32_t interval;
+  uint32_t elapsed;
+  uint32_t timeout;
+#if (ETH_RX_MODERATION != 0)
+  uint32_t poll;
+#endif
+  uint32_t tick;
+  uint32_t size;
+  uint32_t drop;
+  uint32_t n;
+  NetworkBufferDescriptor_t *pxBufferDescriptor;
+
+  (void)arg;
+
+  interval = (ETH_LINK_INTERVAL * osKernelGetTickFreq ()) / 1000U;
+  if (interval == 0U) {
+    interval = 1U;
+  }
+
+#if (ETH_RX_MODERATION != 0)
+  poll = (ETH_RX_POLL_INTERVAL * osKernelGetTickFreq ()) / 1000U;
+  if (poll == 0U) {
+    poll = 1U;
+  }
+  RX_rate_tick = osKernelGetTickCount ();
+#endif
+
+  /* Check Ethernet link state */
+  LINK_Check ();
+  tick = osKernelGetTickCount ();
+
+  for (;;) {
+    elapsed = osKernelGetTickCount () - tick;
+    if (elapsed >= interval) {
+      /* Monitor link state periodically */
+      LINK_Check ();
+
+      /* Keep the timestamp clock running across system timer overflows */
+      (void)TS_Update ();
+      tick    += elapsed;
+      elapsed  = 0U;
+    }
+
+    /* Queued frames are sent on the transmit event, poll only when the driver does not signal it */
+    timeout = ((TX_Pending () != 0U) && (TX_event == 0U)) ? 1U : (interval - elapsed);
+#if (ETH_RX_MODERATION != 0)
+    if ((RX_poll != 0U) && (timeout > poll)) {
+      /* Poll for received frames */
+      timeout = poll;
+    }
+#endif
+    osThreadFlagsWait (0x0003, osFlagsWaitAny, timeout);
+
+    if (TX_Pending () != 0U) {
+      osMutexAcquire (TX_mutex, osWaitForever);
+      TX_StampDone ();
+      TX_Flush ();
+      osMutexRelease (TX_mutex);
+    }
+
+    /* Receive frames, at most ETH_RX_BUDGET per wakeup */
+    for (n = 0U; n < ETH_RX_BUDGET; n++) {
+      size = RX_Copy (&pxBufferDescriptor);
+      if (size == 0U) {
+        break;
+      }
+      if (pxBufferDescriptor != NULL) {
+        drop = RX_Filter (pxBufferDescriptor);
+        if (drop == RX_DROP_NUM) {
+          RX_Queue (pxBufferDescriptor);
+        } else {
+          /* Drop frame before it reaches the TCP/IP stack */
+          RX_drop[drop]++;
+          vReleaseNetworkBufferAndDescriptor (pxBufferDescriptor);
         }
       }
-    } while (size > 0U);
+    }
+    RX_Send ();
+
+#if (ETH_RX_MODERATION != 0)
+    RX_Moderate (n);
+#endif
+
+    if (n == ETH_RX_BUDGET) {
+      /* More frames may be pending, let other threads run first */
+      osThreadFlagsSet (ETH_tid, 0x0001);
+      osThreadYield ();
+    }
   }
 }
 
 
+/* Network interface extensions of IoT Socket */
+static const iotSocketNetifApi_t NetifApi = {
+  MCast_Add,
+  MCast_Remove,
+  TX_SetPriority,
+  TX_GetPriority,
+  RX_GetTimestamp,
+  TX_SetTimestamp,
+  TX_GetTimestamp
+};
+
 BaseType_t xNetworkInterfaceInitialise (void) {
   BaseType_t rval;
   ARM_ETH_MAC_CAPABILITIES capab;
   uint8_t mac[6];
 
+  if (ETH_tid != NULL) {
+    /* Drivers are initialized, interface is up when the link is up */
+    LINK_wait = 1U;
+    if (LINK_state != ARM_ETH_LINK_UP) {
+      return pdFALSE;
+    }
+    LINK_wait = 0U;
+    return pdTRUE;
+  }
+
   capab = Driver_ETH_MAC->GetCapabilities ();
 
+  /* Checksums calculated by the MAC, others are handled in software */
+  CKS_rx = ((capab.checksum_offload_rx_ip4  != 0U) ? CKS_IP4  : 0U) |
+           ((capab.checksum_offload_rx_ip6  != 0U) ? CKS_IP6  : 0U) |
+           ((capab.checksum_offload_rx_udp  != 0U) ? CKS_UDP  : 0U) |
+           ((capab.checksum_offload_rx_tcp  != 0U) ? CKS_TCP  : 0U) |
+           ((capab.checksum_offload_rx_icmp != 0U) ? CKS_ICMP : 0U);
+  CKS_tx = ((capab.checksum_offload_tx_ip4  != 0U) ? CKS_IP4  : 0U) |
+           ((capab.checksum_offload_tx_ip6  != 0U) ? CKS_IP6  : 0U) |
+           ((capab.checksum_offload_tx_udp  != 0U) ? CKS_UDP  : 0U) |
+           ((capab.checksum_offload_tx_tcp  != 0U) ? CKS_TCP  : 0U) |
+           ((capab.checksum_offload_tx_icmp != 0U) ? CKS_ICMP : 0U);
+
+  /* Timestamps by the MAC precision timer, by the system timer otherwise */
+  TS_hw = capab.precision_timer;
+
+  /* Every frame requests the transmit event, a busy transmitter is always followed by one */
+  TX_event = (capab.event_tx_frame != 0U) ? ARM_ETH_MAC_TX_FRAME_EVENT : 0U;
+
   /* Initialize Ethernet MAC driver */
   rval = Driver_ETH_MAC->Initialize (ETH_MAC_SignalEvent);
 
@@ -216,6 +1454,41 @@ BaseType_t xNetworkInterfaceInitialise (void) {
     rval = Driver_ETH_MAC->SetMacAddress ((ARM_ETH_MAC_ADDR *)&mac[0]);
   }
 
+#if (ETH_VLAN_FILTER != 0)
+  if (rval == ARM_DRIVER_OK) {
+    /* VLAN filter in hardware when supported, frames are filtered in software otherwise */
+    (void)Driver_ETH_MAC->Control (ARM_ETH_MAC_VLAN_FILTER, ETH_VLAN_ID | ARM_ETH_MAC_VLAN_FILTER_ID_ONLY);
+  }
+#endif
+
+  if (rval == ARM_DRIVER_OK) {
+    /* Receive only subscribed multicast groups */
+    if (MCast_mutex == NULL) {
+      MCast_mutex = osMutexNew (NULL);
+    }
+
+    if (MCast_mutex == NULL) {
+      rval = ARM_DRIVER_ERROR;
+    } else {
+      rval = MCast_Update ();
+    }
+  }
+
+  if (rval == ARM_DRIVER_OK) {
+    /* Transmit queue */
+    if (TX_mutex == NULL) {
+      TX_mutex = osMutexNew (NULL);
+    }
+
+    if (TX_evt == NULL) {
+      TX_evt = osEventFlagsNew (NULL);
+    }
+
+    if ((TX_mutex == NULL) || (TX_evt == NULL)) {
+      rval = ARM_DRIVER_ERROR;
+    }
+  }
+
   if (rval == ARM_DRIVER_OK) {
     /* Initialize Ethernet PHY driver */
     rval = Driver_ETH_PHY->Initialize (Driver_ETH_MAC->PHY_Read, Driver_ETH_MAC->PHY_Write);
@@ -247,8 +1520,18 @@ BaseType_t xNetworkInterfaceInitialise (void) {
   }
 
   if (rval == ARM_DRIVER_OK) {
+    /* Provide multicast filter, transmit priority and timestamps to IoT Socket */
+    (void)iotSocketRegisterNetif (&NetifApi);
+  }
+
+  /* Set before the link state is read, a link up in between restarts the initialization */
+  LINK_wait = 1U;
+
+  if ((rval == ARM_DRIVER_OK) && (LINK_state == ARM_ETH_LINK_UP)) {
+    LINK_wait = 0U;
     rval = pdTRUE;
   } else {
+    /* Link is not up yet, the IP task retries the initialization when the link comes up */
     rval = pdFALSE;
   }
 
@@ -256,30 +1539,109 @@ BaseType_t xNetworkInterfaceInitialise (void) {
 }
 
 BaseType_t xNetworkInterfaceOutput (NetworkBufferDescriptor_t *const pxNetworkBuffer, BaseType_t xReleaseAfterSend) {
+  NetworkBufferDescriptor_t *pxBuffer;
   BaseType_t rval;
   uint8_t *frame;
   uint32_t len;
-  uint32_t flags;
+  uint8_t prio;
+  uint32_t tick;
+  uint32_t wait;
+  uint32_t i;
 
-  /* Send Ethernet frame */
   frame = pxNetworkBuffer->pucEthernetBuffer;
   len   = pxNetworkBuffer->xDataLength;
 
-  rval = Driver_ETH_MAC->SendFrame (frame, len, 0U);
+  /* Checksums not calculated by the MAC */
+  CKS_Insert (frame, len);
+
+  if (osMutexAcquire (TX_mutex, osWaitForever) != osOK) {
+    if (xReleaseAfterSend == pdTRUE) {
+      vReleaseNetworkBufferAndDescriptor (pxNetworkBuffer);
+    }
+    return pdFALSE;
+  }
+
+  pxBuffer = pxNetworkBuffer;
+
+  if (xReleaseAfterSend != pdTRUE) {
+    /* Buffer remains owned by the stack */
+    if (TX_count == 0U) {
+      /* No frames waiting, send Ethernet frame immediately */
+      rval = TX_Send (frame, len, TX_event);
+
+      if (rval != ARM_DRIVER_ERROR_BUSY) {
+        osMutexRelease (TX_mutex);
 
-  /* Call the standard trace macro to log the send event. */
-  iptraceNETWORK_INTERFACE_TRANSMIT();
+        /* Call the standard trace macro to log the send event. */
+        iptraceNETWORK_INTERFACE_TRANSMIT();
 
-  if (xReleaseAfterSend == pdTRUE) {
-    /* Release buffer after has been sent */
-    vReleaseNetworkBufferAndDescriptor (pxNetworkBuffer);
+        return (rval == ARM_DRIVER_OK) ? pdTRUE : pdFALSE;
+      }
+    }
+
+    /* Queue a copy of the frame behind the waiting frames */
+    pxBuffer = pxDuplicateNetworkBufferWithDescriptor (pxNetworkBuffer, len);
+    if (pxBuffer == NULL) {
+      TX_drop++;
+      osMutexRelease (TX_mutex);
+      return pdFALSE;
+    }
+    frame = pxBuffer->pucEthernetBuffer;
   }
 
-  if (rval == ARM_DRIVER_OK) {
-    rval = pdTRUE;
-  } else {
-    rval = pdFALSE;
+  if ((TX_count == ETH_TX_QUEUE_LEN) && (xIsCallingFromIPTask () == pdFALSE)) {
+    /* Queue is full, wait for the worker thread to send frames (the IP task never waits) */
+    tick = osKernelGetTickCount ();
+    wait = (ETH_TX_QUEUE_WAIT * osKernelGetTickFreq ()) / 1000U;
+    while ((TX_count == ETH_TX_QUEUE_LEN) && ((osKernelGetTickCount () - tick) < wait)) {
+      osEventFlagsClear (TX_evt, 0x0001U);
+      osMutexRelease (TX_mutex);
+
+      (void)osEventFlagsWait (TX_evt, 0x0001U, osFlagsWaitAny, wait - (osKernelGetTickCount () - tick));
+
+      if (osMutexAcquire (TX_mutex, osWaitForever) != osOK) {
+        vReleaseNetworkBufferAndDescriptor (pxBuffer);
+        return pdFALSE;
+      }
+    }
+  }
+
+  prio = TX_Priority (frame, len);
+
+  /* Insert frame behind queued frames of the same or higher priority */
+  for (i = TX_count; (i > 0U) && (TX_Queue[i - 1U].prio < prio); i--);
+
+  rval = pdTRUE;
+  if (TX_count == ETH_TX_QUEUE_LEN) {
+    /* Queue is still full, drop a frame */
+    TX_drop++;
+
+    if (i == ETH_TX_QUEUE_LEN) {
+      /* Queue is full with frames of the same or higher priority, drop the frame */
+      vReleaseNetworkBufferAndDescriptor (pxBuffer);
+      rval = pdFALSE;
+    } else {
+      /* Drop the last frame with the lowest priority */
+      TX_count--;
+      vReleaseNetworkBufferAndDescriptor (TX_Queue[TX_count].buf);
+    }
+  }
+
+  if (rval == pdTRUE) {
+    memmove (&TX_Queue[i + 1U], &TX_Queue[i], (TX_count - i) * sizeof(TX_Queue[0]));
+    TX_Queue[i].buf  = pxBuffer;
+    TX_Queue[i].prio = prio;
+    TX_count++;
   }
 
+  TX_Flush ();
+
+  if ((TX_count != 0U) && (TX_event == 0U)) {
+    /* Frames are waiting and no transmit event follows, worker thread polls */
+    osThreadFlagsSet (ETH_tid, 0x0002);
+  }
+
+  osMutexRelease (TX_mutex);
+
   return rval;
 }
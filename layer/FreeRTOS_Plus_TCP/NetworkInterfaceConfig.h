@@ -1,5 +1,5 @@
 /* -----------------------------------------------------------------------------
- * Copyright (c) 2021 Arm Limited (or its affiliates). All rights reserved.
+ * Copyright (c) 2021-2026 Arm Limited (or its affiliates). All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -49,6 +49,84 @@
 #define ETH_MAC_ADDR5           0x1E
 // </h>
 
+// <o>Ethernet thread stack size [bytes] <512-8192:8>
+// <i>Stack of the thread that receives frames, flushes the transmit queue and monitors the link.
+// <i>It calls into the Ethernet MAC and PHY drivers, the FreeRTOS+TCP checksum and event
+// <i>functions and the link hook of the application. Increase it for drivers or hooks
+// <i>that need more stack.
+#define ETH_THREAD_STACK_SIZE   1024
+
+// <o>Link check interval [ms] <10-10000>
+// <i>Interval for polling the Ethernet PHY link state.
+// <i>The MAC is reconfigured when link speed or duplex mode changes.
+#define ETH_LINK_INTERVAL       500
+
+// <q>Receive broadcast frames
+// <i>Accept frames sent to the broadcast address (required for ARP and DHCP).
+#define ETH_RX_BROADCAST        1
+
+// <e>VLAN filter
+// <i>Receive only frames tagged with the configured VLAN identifier and untagged frames.
+// <i>The VLAN tag is removed before the frame is passed to the TCP/IP stack.
+#define ETH_VLAN_FILTER         0
+
+//   <o>VLAN identifier <1-4094>
+#define ETH_VLAN_ID             1
+// </e>
+
+// <o>Multicast MAC address filter size <1-32>
+// <i>Number of multicast groups that can be received through the MAC address filter.
+// <i>All multicast frames are received when more groups are joined.
+#define ETH_MCAST_NUM           8
+
+// <o>Transmit queue length <1-64>
+// <i>Number of frames queued while the Ethernet MAC transmitter is busy.
+// <i>Queued frames are sent in order of socket priority (IOT_SOCKET_SO_PRIORITY).
+// <i>The frame with the lowest priority is dropped when the queue is full.
+#define ETH_TX_QUEUE_LEN        8
+
+// <o>Transmit queue wait time [ms] <0-1000>
+// <i>Time a thread other than the IP task waits for space in the full transmit queue
+// <i>before the frame with the lowest priority is dropped. The IP task never waits.
+#define ETH_TX_QUEUE_WAIT       10
+
+// <o>Number of prioritized ports <1-32>
+// <i>Number of local ports with transmit priority set by IOT_SOCKET_SO_PRIORITY.
+#define ETH_TX_PRIO_NUM         4
+
+// <o>Number of timestamped ports <1-32>
+// <i>Number of local ports with transmit timestamping enabled by IOT_SOCKET_SO_TIMESTAMP.
+// <i>Timestamps are taken by the Ethernet MAC precision timer when available.
+#define ETH_TX_TS_NUM           4
+
+// <o>Receive budget per wakeup <1-256>
+// <i>Maximum number of frames received before other threads may run.
+#define ETH_RX_BUDGET           16
+
+// <o>Receive batch length <1-64>
+// <i>Maximum number of frames passed to the TCP/IP stack in one event.
+// <i>Frames are batched only when ipconfigUSE_LINKED_RX_MESSAGES is enabled in FreeRTOSIPConfig.h
+// <i>(enabled by default), otherwise each frame is passed in its own event.
+#define ETH_RX_BATCH_LEN        8
+
+// <e>Receive interrupt moderation
+// <i>Above the receive rate threshold, received frames are polled periodically
+// <i>instead of waking up the worker thread on every receive event.
+// <i>Receive events wake up the thread again when the poll window passes without frames.
+#define ETH_RX_MODERATION       1
+
+//   <o>Receive rate threshold [frames/s] <100-1000000>
+//   <i>Receive rate at which polling starts.
+#define ETH_RX_POLL_RATE        2000
+
+//   <o>Poll interval [ms] <1-100>
+#define ETH_RX_POLL_INTERVAL    1
+
+//   <o>Poll window [ms] <1-1000>
+//   <i>Time without received frames after which polling stops.
+#define ETH_RX_POLL_WINDOW      10
+// </e>
+
 // <h>Static IP address configuration
 //   <h>IP Address
 //     <o>IP Address byte 1 <0-255>
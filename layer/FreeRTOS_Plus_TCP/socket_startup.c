@@ -1,5 +1,5 @@
 /* -----------------------------------------------------------------------------
- * Copyright (c) 2021 Arm Limited (or its affiliates). All rights reserved.
+ * Copyright (c) 2021-2026 Arm Limited (or its affiliates). All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -20,8 +20,26 @@
 #include "cmsis_os2.h"
 
 #include "FreeRTOS_IP.h"
+#include "FreeRTOS_DNS.h"
 #include "NetworkInterfaceConfig.h"
 
+/* Network bring-up timeout in ms */
+#define NET_STARTUP_TIMEOUT     30000U
+
+/* Network events */
+#define NET_EVENT_LINK          0x0001U         /* Ethernet link is up */
+#define NET_EVENT_UP            0x0002U         /* IP address is bound */
+
+/* Define SOCKET_STARTUP_DNS_HOST as host name to measure the first DNS lookup */
+
+#ifdef SOCKET_STARTUP_REPORT
+/* Define SOCKET_STARTUP_REPORT to receive the bring-up phase times [ms] in the application */
+extern void socket_startup_report (uint32_t link_ms, uint32_t dhcp_ms, uint32_t dns_ms);
+#endif
+
+/* Link state callback of the network interface */
+extern void vNetworkInterfaceSetLinkHook (void (*pxHook) (BaseType_t xLinkUp));
+
 /* IP address (used when DHCP fails or if ipconfigUSE_DHCP is 0) */
 static const uint8_t NetIPaddr[4] = {
   ETH_IP_ADDR0, ETH_IP_ADDR1, ETH_IP_ADDR2, ETH_IP_ADDR3
@@ -47,44 +65,81 @@ extern const char *pcApplicationHostnameHook (void) {
   return "FreeRTOS+TCP_Net";
 }
 
+static osEventFlagsId_t NetEvent;
+
+/* Bring-up phase times (kernel ticks) */
+static uint32_t NetTickStart;
+static uint32_t NetTickLink;
+static uint32_t NetTickUp;
+static uint32_t NetTickDNS;
+
+#ifdef SOCKET_STARTUP_REPORT
+/* Convert kernel ticks to ms */
+static uint32_t ticks_to_ms (uint32_t ticks) {
+  return (uint32_t)(((uint64_t)ticks * 1000U) / osKernelGetTickFreq ());
+}
+#endif
+
 uint8_t NetUp;
 /* Network event callback (called when ipconfigUSE_NETWORK_EVENT_HOOK is 1) */
 void vApplicationIPNetworkEventHook (eIPCallbackEvent_t eNetworkEvent) {
 
   if (eNetworkEvent == eNetworkUp) {
     NetUp = 1U;
+    NetTickUp = osKernelGetTickCount ();
+    osEventFlagsSet (NetEvent, NET_EVENT_UP);
   } else /* eNetworkDown */ {
     NetUp = 0U;
+    osEventFlagsClear (NetEvent, NET_EVENT_UP);
+  }
+}
+
+/* Link state callback (called by the network interface) */
+static void NetLinkHook (BaseType_t xLinkUp) {
+
+  if ((xLinkUp == pdTRUE) && ((osEventFlagsGet (NetEvent) & NET_EVENT_LINK) == 0U)) {
+    /* First link up */
+    NetTickLink = osKernelGetTickCount ();
+    osEventFlagsSet (NetEvent, NET_EVENT_LINK);
   }
 }
 
 int32_t socket_startup (void) {
   int32_t rval;
-  uint32_t tout;
 
-  /* Initialize network stack */
-  if (FreeRTOS_IPInit (NetIPaddr, NetMask, NetGateway, NetDNSserver, EthMAC) != pdPASS) {
-    printf("Network interface initialization failed.\r\n");
+  NetEvent     = osEventFlagsNew (NULL);
+  NetTickStart = osKernelGetTickCount ();
+
+  if (NetEvent != NULL) {
+    vNetworkInterfaceSetLinkHook (NetLinkHook);
   }
-  else {
-    printf("Waiting for network connection...\r\n");
 
+  /* Initialize network stack */
+  if ((NetEvent != NULL) &&
+      (FreeRTOS_IPInit (NetIPaddr, NetMask, NetGateway, NetDNSserver, EthMAC) == pdPASS)) {
     /* Wait until network is up or timeout expires */
-    for (tout = 30000U; tout; tout -= 200U) {
-      if (NetUp == 0U) {
-        osDelay(200U);
-      }
-    }
+    osEventFlagsWait (NetEvent, NET_EVENT_UP, osFlagsWaitAny | osFlagsNoClear,
+                      (NET_STARTUP_TIMEOUT * osKernelGetTickFreq ()) / 1000U);
   }
 
   if (NetUp == 0U) {
     /* Network is down */
-    printf("Network is down!\r\n");
     rval = 1;
   } else {
     /* Network is up */
-    printf("Network is up!\r\n");
     rval = 0;
+
+    NetTickDNS = NetTickUp;
+#ifdef SOCKET_STARTUP_DNS_HOST
+    (void)FreeRTOS_gethostbyname (SOCKET_STARTUP_DNS_HOST);
+    NetTickDNS = osKernelGetTickCount ();
+#endif
+
+#ifdef SOCKET_STARTUP_REPORT
+    socket_startup_report (ticks_to_ms (NetTickLink - NetTickStart),
+                           ticks_to_ms (NetTickUp   - NetTickLink),
+                           ticks_to_ms (NetTickDNS  - NetTickUp));
+#endif
   }
 
   return rval;
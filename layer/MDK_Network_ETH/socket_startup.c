@@ -1,5 +1,5 @@
 /* -----------------------------------------------------------------------------
- * Copyright (c) 2020 Arm Limited (or its affiliates). All rights reserved.
+ * Copyright (c) 2020-2026 Arm Limited (or its affiliates). All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -19,17 +19,121 @@
 #include "cmsis_os2.h"
 #include "rl_net.h"
 
-int32_t socket_startup (void) {
+/* Network bring-up timeout in ms */
+#define NET_STARTUP_TIMEOUT     30000U
+
+/* Network events */
+#define NET_EVENT_LINK          0x0001U         /* Link is up */
+#define NET_EVENT_UP            0x0002U         /* IP address is assigned by DHCP */
+
+/* Define SOCKET_STARTUP_DNS_HOST as host name to measure the first DNS lookup */
+
+#ifdef SOCKET_STARTUP_REPORT
+/* Define SOCKET_STARTUP_REPORT to receive the bring-up phase times [ms] in the application */
+extern void socket_startup_report (uint32_t link_ms, uint32_t dhcp_ms, uint32_t dns_ms);
+#endif
+
+static osEventFlagsId_t NetEvent;
+
+/* Bring-up phase times (kernel ticks) */
+static uint32_t NetTickStart;
+static uint32_t NetTickLink;
+static uint32_t NetTickUp;
+static uint32_t NetTickDNS;
+
+#ifdef SOCKET_STARTUP_REPORT
+/* Convert kernel ticks to ms */
+static uint32_t ticks_to_ms (uint32_t ticks) {
+  return (uint32_t)(((uint64_t)ticks * 1000U) / osKernelGetTickFreq ());
+}
+#endif
+
+/* Ethernet link notification of the Network Component */
+void netETH_Notify (uint32_t if_num, netETH_Event event, uint32_t val) {
+  (void)if_num;
+  (void)val;
+
+  if ((event == netETH_LinkUp) && ((osEventFlagsGet (NetEvent) & NET_EVENT_LINK) == 0U)) {
+    NetTickLink = osKernelGetTickCount ();
+    osEventFlagsSet (NetEvent, NET_EVENT_LINK);
+  }
+}
+
+/* DHCP notification of the Network Component */
+void netDHCP_Notify (uint32_t if_num, uint8_t option, const uint8_t *val, uint32_t len) {
+  (void)if_num;
+
+  if ((option == NET_DHCP_OPTION_IP_ADDRESS) && (val != NULL) && (len >= 4U) &&
+      ((val[0] | val[1] | val[2] | val[3]) != 0U)) {
+    /* IP address assigned */
+    NetTickUp = osKernelGetTickCount ();
+    osEventFlagsSet (NetEvent, NET_EVENT_UP);
+  }
+}
+
+/* Return IPv4 address of the Ethernet interface (0 = not assigned) */
+static uint32_t ip4_address (void) {
   uint32_t addr;
 
+  addr = 0U;
+  netIF_GetOption(NET_IF_CLASS_ETH | 0,
+                  netIF_OptionIP4_Address,
+                  (uint8_t *)&addr, sizeof (addr));
+
+  return addr;
+}
+
+int32_t socket_startup (void) {
+  uint32_t tout;
+  uint32_t tick;
+#ifdef SOCKET_STARTUP_DNS_HOST
+  NET_ADDR host;
+#endif
+
+  NetEvent     = osEventFlagsNew (NULL);
+  NetTickStart = osKernelGetTickCount ();
+  tout         = (NET_STARTUP_TIMEOUT * osKernelGetTickFreq ()) / 1000U;
+
+  if (NetEvent == NULL) {
+    return 1;
+  }
+
   netInitialize();
 
-  do {
-   osDelay(500U);
-   netIF_GetOption(NET_IF_CLASS_ETH | 0,
-                   netIF_OptionIP4_Address,
-                   (uint8_t *)&addr, sizeof (addr));
-  } while (addr == 0U);
+  /* Wait until link is up */
+  osEventFlagsWait (NetEvent, NET_EVENT_LINK, osFlagsWaitAny | osFlagsNoClear, tout);
+
+  if ((osEventFlagsGet (NetEvent) & NET_EVENT_LINK) != 0U) {
+    if (ip4_address () == 0U) {
+      /* Wait until DHCP assigns the IP address */
+      tick = osKernelGetTickCount () - NetTickStart;
+      if (tick < tout) {
+        osEventFlagsWait (NetEvent, NET_EVENT_UP, osFlagsWaitAny | osFlagsNoClear, tout - tick);
+      }
+    }
+    else if ((osEventFlagsGet (NetEvent) & NET_EVENT_UP) == 0U) {
+      /* Static IP address, no DHCP phase */
+      NetTickUp = NetTickLink;
+    }
+  }
+
+  if (ip4_address () == 0U) {
+    /* Network is down */
+    return 1;
+  }
+
+  /* Network is up */
+  NetTickDNS = NetTickUp;
+#ifdef SOCKET_STARTUP_DNS_HOST
+  (void)netDNSc_GetHostByNameX (SOCKET_STARTUP_DNS_HOST, NET_ADDR_IP4, &host);
+  NetTickDNS = osKernelGetTickCount ();
+#endif
+
+#ifdef SOCKET_STARTUP_REPORT
+  socket_startup_report (ticks_to_ms (NetTickLink - NetTickStart),
+                         ticks_to_ms (NetTickUp   - NetTickLink),
+                         ticks_to_ms (NetTickDNS  - NetTickUp));
+#endif
 
   return 0;
 }
@@ -0,0 +1,464 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * -------------------------------------------------------------------------- */
+
+#include <string.h>
+#include "iot_socket.h"
+#include "iot_socket_conn_pool.h"
+#include "cmsis_os2.h"
+
+// Number of connections managed by the pool (idle and in use)
+#ifndef IOT_SOCKET_CONN_POOL_SIZE
+#define IOT_SOCKET_CONN_POOL_SIZE         8
+#endif
+
+// Maximum number of connections to the same remote address and port
+#ifndef IOT_SOCKET_CONN_POOL_MAX_PER_HOST
+#define IOT_SOCKET_CONN_POOL_MAX_PER_HOST 2
+#endif
+
+// Maximum time in seconds a connection is kept idle
+#ifndef IOT_SOCKET_CONN_POOL_IDLE_TIME
+#define IOT_SOCKET_CONN_POOL_IDLE_TIME    60
+#endif
+
+#if (IOT_SOCKET_CONN_POOL_SIZE > 254)
+#error "IOT_SOCKET_CONN_POOL_SIZE must not exceed 254"
+#endif
+
+#define POOL_NONE       0xFFU   // End of list
+
+// Entry states
+#define POOL_FREE       0U      // Entry not used
+#define POOL_IDLE       1U      // Connection available for reuse
+#define POOL_BUSY       2U      // Connection handed out (or being connected)
+
+// Pool entry
+typedef struct {
+  uint8_t  ip[16];              // Remote address
+  uint8_t  ip_len;              // Remote address length
+  uint8_t  state;               // Entry state
+  uint16_t port;                // Remote port
+  int32_t  sock;                // Socket (-1 while connecting)
+  uint32_t stamp;               // Tick count when the connection became idle
+  uint8_t  host_next;           // Next entry in host hash chain (free list for free entries)
+  uint8_t  sock_next;           // Next entry in socket hash chain
+  uint8_t  idle_prev;           // Previous (older) idle entry
+  uint8_t  idle_next;           // Next (newer) idle entry
+} pool_entry_t;
+
+static pool_entry_t             pool[IOT_SOCKET_CONN_POOL_SIZE];
+static uint8_t                  pool_host[IOT_SOCKET_CONN_POOL_SIZE];
+static uint8_t                  pool_sock[IOT_SOCKET_CONN_POOL_SIZE];
+static uint8_t                  pool_free;
+static uint8_t                  pool_idle_head;
+static uint8_t                  pool_idle_tail;
+static uint8_t                  pool_ready;
+static iotSocketConnPoolStats_t pool_stats;
+static osMutexId_t              pool_mutex;
+
+static const osMutexAttr_t pool_mutex_attr = {
+  "iotSocketConnPool",
+  osMutexPrioInherit,
+  NULL,
+  0U
+};
+
+// Initialize lists (called with lock held)
+static void pool_init (void) {
+  uint32_t n;
+
+  for (n = 0U; n < IOT_SOCKET_CONN_POOL_SIZE; n++) {
+    pool[n].state     = POOL_FREE;
+    pool[n].host_next = (n < (IOT_SOCKET_CONN_POOL_SIZE - 1U)) ? (uint8_t)(n + 1U) : POOL_NONE;
+    pool_host[n]      = POOL_NONE;
+    pool_sock[n]      = POOL_NONE;
+  }
+  pool_free      = 0U;
+  pool_idle_head = POOL_NONE;
+  pool_idle_tail = POOL_NONE;
+  pool_ready     = 1U;
+}
+
+// Acquire pool lock (mutex is created on first use)
+static int32_t pool_lock (void) {
+  int32_t lock;
+
+  if (pool_mutex == NULL) {
+    lock = osKernelLock();
+    if (pool_mutex == NULL) {
+      pool_mutex = osMutexNew(&pool_mutex_attr);
+    }
+    osKernelRestoreLock(lock);
+    if (pool_mutex == NULL) {
+      return IOT_SOCKET_ERROR;
+    }
+  }
+  if (osMutexAcquire(pool_mutex, osWaitForever) != osOK) {
+    return IOT_SOCKET_ERROR;
+  }
+  if (pool_ready == 0U) {
+    pool_init();
+  }
+  return 0;
+}
+
+// Release pool lock
+static void pool_unlock (void) {
+  osMutexRelease(pool_mutex);
+}
+
+// Hash remote address and port (FNV-1a)
+static uint32_t pool_host_hash (const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  uint32_t h = 2166136261U;
+  uint32_t n;
+
+  for (n = 0U; n < ip_len; n++) {
+    h = (h ^ ip[n]) * 16777619U;
+  }
+  h = (h ^ (port & 0xFFU)) * 16777619U;
+  h = (h ^ (port >> 8))    * 16777619U;
+
+  return (h % IOT_SOCKET_CONN_POOL_SIZE);
+}
+
+// Hash socket identification number
+static uint32_t pool_sock_hash (int32_t sock) {
+  uint32_t h = (uint32_t)sock;
+
+  h ^= h >> 16;
+  h *= 2654435761U;
+  h ^= h >> 16;
+
+  return (h % IOT_SOCKET_CONN_POOL_SIZE);
+}
+
+// Check if entry belongs to remote address and port
+static int32_t pool_match (const pool_entry_t *entry, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+
+  if ((entry->ip_len == ip_len) && (entry->port == port) && (memcmp(entry->ip, ip, ip_len) == 0)) {
+    return 1;
+  }
+  return 0;
+}
+
+// Append entry to the idle list (called with lock held)
+static void pool_idle_append (uint8_t idx) {
+
+  pool[idx].idle_prev = pool_idle_tail;
+  pool[idx].idle_next = POOL_NONE;
+  if (pool_idle_tail != POOL_NONE) {
+    pool[pool_idle_tail].idle_next = idx;
+  } else {
+    pool_idle_head = idx;
+  }
+  pool_idle_tail = idx;
+}
+
+// Remove entry from the idle list (called with lock held)
+static void pool_idle_remove (uint8_t idx) {
+
+  if (pool[idx].idle_prev != POOL_NONE) {
+    pool[pool[idx].idle_prev].idle_next = pool[idx].idle_next;
+  } else {
+    pool_idle_head = pool[idx].idle_next;
+  }
+  if (pool[idx].idle_next != POOL_NONE) {
+    pool[pool[idx].idle_next].idle_prev = pool[idx].idle_prev;
+  } else {
+    pool_idle_tail = pool[idx].idle_prev;
+  }
+}
+
+// Find entry of a socket handed out by the pool (called with lock held)
+static uint8_t pool_sock_find (int32_t sock) {
+  uint8_t idx;
+
+  for (idx = pool_sock[pool_sock_hash(sock)]; idx != POOL_NONE; idx = pool[idx].sock_next) {
+    if (pool[idx].sock == sock) {
+      break;
+    }
+  }
+  return idx;
+}
+
+// Allocate entry for a new connection (called with lock held)
+static uint8_t pool_alloc (const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  uint32_t h;
+  uint8_t  idx;
+
+  idx = pool_free;
+  pool_free = pool[idx].host_next;
+
+  memcpy(pool[idx].ip, ip, ip_len);
+  pool[idx].ip_len    = (uint8_t)ip_len;
+  pool[idx].port      = port;
+  pool[idx].sock      = -1;
+  pool[idx].state     = POOL_BUSY;
+
+  h = pool_host_hash(ip, ip_len, port);
+  pool[idx].host_next = pool_host[h];
+  pool_host[h]        = idx;
+
+  return idx;
+}
+
+// Register socket of a connected entry (called with lock held)
+static void pool_attach (uint8_t idx, int32_t sock) {
+  uint32_t h;
+
+  h = pool_sock_hash(sock);
+  pool[idx].sock      = sock;
+  pool[idx].sock_next = pool_sock[h];
+  pool_sock[h]        = idx;
+}
+
+// Release entry and return its socket (called with lock held)
+static int32_t pool_release (uint8_t idx) {
+  uint8_t *link;
+  int32_t  sock;
+
+  // Remove from host hash chain
+  link = &pool_host[pool_host_hash(pool[idx].ip, pool[idx].ip_len, pool[idx].port)];
+  while (*link != idx) {
+    link = &pool[*link].host_next;
+  }
+  *link = pool[idx].host_next;
+
+  // Remove from socket hash chain
+  sock = pool[idx].sock;
+  if (sock >= 0) {
+    link = &pool_sock[pool_sock_hash(sock)];
+    while (*link != idx) {
+      link = &pool[*link].sock_next;
+    }
+    *link = pool[idx].sock_next;
+  }
+
+  if (pool[idx].state == POOL_IDLE) {
+    pool_idle_remove(idx);
+  }
+
+  pool[idx].state     = POOL_FREE;
+  pool[idx].host_next = pool_free;
+  pool_free = idx;
+
+  return sock;
+}
+
+// Check if an idle connection is still usable
+static int32_t pool_probe (int32_t sock) {
+  unsigned long nbio;
+  int32_t rc;
+
+  nbio = 1U;
+  if (iotSocketSetOpt(sock, IOT_SOCKET_IO_FIONBIO, &nbio, sizeof(nbio)) != 0) {
+    return 0;
+  }
+
+  // An idle connection must not be readable (readable means closed by the peer or unexpected data)
+  rc = iotSocketRecv(sock, NULL, 0U);
+  if (rc == IOT_SOCKET_EAGAIN) {
+    rc = iotSocketSend(sock, NULL, 0U);
+  } else {
+    rc = IOT_SOCKET_ERROR;
+  }
+
+  nbio = 0U;
+  if (iotSocketSetOpt(sock, IOT_SOCKET_IO_FIONBIO, &nbio, sizeof(nbio)) != 0) {
+    return 0;
+  }
+  return (rc >= 0) ? 1 : 0;
+}
+
+// Create socket and connect to remote host
+static int32_t pool_connect (const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  int32_t keepalive = 1;
+  int32_t af;
+  int32_t sock;
+  int32_t rc;
+
+  af = (ip_len == 4U) ? IOT_SOCKET_AF_INET : IOT_SOCKET_AF_INET6;
+  sock = iotSocketCreate(af, IOT_SOCKET_SOCK_STREAM, IOT_SOCKET_IPPROTO_TCP);
+  if (sock < 0) {
+    return sock;
+  }
+
+  // Let the stack detect a dead peer while the connection is idle (ignored when not supported)
+  iotSocketSetOpt(sock, IOT_SOCKET_SO_KEEPALIVE, &keepalive, sizeof(keepalive));
+
+  rc = iotSocketConnect(sock, ip, ip_len, port);
+  if (rc != 0) {
+    iotSocketClose(sock);
+    return rc;
+  }
+  return sock;
+}
+
+// Get a connected stream socket from the connection pool
+int32_t iotSocketConnPoolGet (const uint8_t *ip, uint32_t ip_len, uint16_t port) {
+  uint32_t now, age, count;
+  uint8_t  idx, n;
+  int32_t  sock, evict;
+  int32_t  rc;
+
+  // Check parameters
+  if ((ip == NULL) || ((ip_len != 4U) && (ip_len != 16U)) || (port == 0U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  for (;;) {
+    if (pool_lock() != 0) {
+      return IOT_SOCKET_ERROR;
+    }
+    now   = osKernelGetTickCount();
+    idx   = POOL_NONE;
+    age   = 0U;
+    count = 0U;
+    evict = -1;
+
+    // Find the most recently returned idle connection to this host
+    for (n = pool_host[pool_host_hash(ip, ip_len, port)]; n != POOL_NONE; n = pool[n].host_next) {
+      if (pool_match(&pool[n], ip, ip_len, port)) {
+        count++;
+        if ((pool[n].state == POOL_IDLE) && ((idx == POOL_NONE) || ((now - pool[n].stamp) < age))) {
+          idx = n;
+          age = now - pool[n].stamp;
+        }
+      }
+    }
+
+    if (idx != POOL_NONE) {
+      pool_idle_remove(idx);
+      pool[idx].state = POOL_BUSY;
+      sock = pool[idx].sock;
+      pool_unlock();
+
+      if ((age < (IOT_SOCKET_CONN_POOL_IDLE_TIME * osKernelGetTickFreq())) && pool_probe(sock)) {
+        pool_lock();
+        pool_stats.hits++;
+        pool_unlock();
+        return sock;
+      }
+
+      // Connection expired or no longer alive
+      pool_lock();
+      pool_stats.stale++;
+      pool_release(idx);
+      pool_unlock();
+      iotSocketClose(sock);
+      continue;
+    }
+
+    if (count >= IOT_SOCKET_CONN_POOL_MAX_PER_HOST) {
+      pool_unlock();
+      return IOT_SOCKET_EAGAIN;
+    }
+    if (pool_free == POOL_NONE) {
+      if (pool_idle_head == POOL_NONE) {
+        pool_unlock();
+        return IOT_SOCKET_ENOMEM;
+      }
+      // Make room by closing the least recently used idle connection
+      evict = pool_release(pool_idle_head);
+      pool_stats.evictions++;
+    }
+    idx = pool_alloc(ip, ip_len, port);
+    pool_unlock();
+
+    if (evict >= 0) {
+      iotSocketClose(evict);
+    }
+
+    // Open new connection (lock is not held while connecting)
+    rc = pool_connect(ip, ip_len, port);
+
+    pool_lock();
+    if (rc >= 0) {
+      pool_attach(idx, rc);
+      pool_stats.misses++;
+    } else {
+      pool_release(idx);
+    }
+    pool_unlock();
+
+    return rc;
+  }
+}
+
+// Return a socket to the connection pool
+int32_t iotSocketConnPoolPut (int32_t socket, int32_t reuse) {
+  uint8_t idx;
+
+  if (pool_lock() != 0) {
+    return IOT_SOCKET_ERROR;
+  }
+  idx = pool_sock_find(socket);
+  if ((idx == POOL_NONE) || (pool[idx].state != POOL_BUSY)) {
+    pool_unlock();
+    return IOT_SOCKET_ESOCK;
+  }
+
+  if (reuse != 0) {
+    pool[idx].state = POOL_IDLE;
+    pool[idx].stamp = osKernelGetTickCount();
+    pool_idle_append(idx);
+    pool_unlock();
+    return 0;
+  }
+
+  pool_release(idx);
+  pool_unlock();
+  iotSocketClose(socket);
+
+  return 0;
+}
+
+// Close all idle connections in the connection pool
+int32_t iotSocketConnPoolFlush (void) {
+  int32_t sock;
+
+  for (;;) {
+    if (pool_lock() != 0) {
+      return IOT_SOCKET_ERROR;
+    }
+    if (pool_idle_head == POOL_NONE) {
+      pool_unlock();
+      break;
+    }
+    sock = pool_release(pool_idle_head);
+    pool_unlock();
+    iotSocketClose(sock);
+  }
+
+  return 0;
+}
+
+// Retrieve connection pool statistics
+int32_t iotSocketConnPoolGetStats (iotSocketConnPoolStats_t *stats) {
+
+  if (stats == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if (pool_lock() != 0) {
+    return IOT_SOCKET_ERROR;
+  }
+  memcpy(stats, &pool_stats, sizeof(pool_stats));
+  pool_unlock();
+
+  return 0;
+}
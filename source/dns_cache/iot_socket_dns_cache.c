@@ -0,0 +1,292 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * -------------------------------------------------------------------------- */
+
+#include <string.h>
+#include "iot_socket.h"
+#include "iot_socket_dns_cache.h"
+#include "cmsis_os2.h"
+
+// Number of cache entries
+#ifndef IOT_SOCKET_DNS_CACHE_ENTRIES
+#define IOT_SOCKET_DNS_CACHE_ENTRIES    8
+#endif
+
+// Maximum length of a cached host name (longer names bypass the cache)
+#ifndef IOT_SOCKET_DNS_CACHE_NAME_LEN
+#define IOT_SOCKET_DNS_CACHE_NAME_LEN   64
+#endif
+
+// Lifetime of a positive entry in seconds (used when the resolver reports no TTL)
+#ifndef IOT_SOCKET_DNS_CACHE_TTL
+#define IOT_SOCKET_DNS_CACHE_TTL        300
+#endif
+
+// Maximum lifetime of a positive entry in seconds
+#ifndef IOT_SOCKET_DNS_CACHE_TTL_MAX
+#define IOT_SOCKET_DNS_CACHE_TTL_MAX    86400
+#endif
+
+// Lifetime of a negative entry in seconds (0 disables negative caching)
+#ifndef IOT_SOCKET_DNS_CACHE_NEG_TTL
+#define IOT_SOCKET_DNS_CACHE_NEG_TTL    10
+#endif
+
+// Cache entry
+typedef struct {
+  char     name[IOT_SOCKET_DNS_CACHE_NAME_LEN];
+  uint8_t  af;                  // Address family (0 = entry not used)
+  uint8_t  ip_len;              // Address length (0 = negative entry)
+  uint8_t  ip[16];              // Resolved address
+  uint32_t stamp;               // Tick count when the entry was stored
+  uint32_t ttl;                 // Lifetime in ticks
+  uint32_t seq;                 // Last use sequence number (LRU)
+} dns_entry_t;
+
+static dns_entry_t              dns_cache[IOT_SOCKET_DNS_CACHE_ENTRIES];
+static iotSocketDnsCacheStats_t dns_stats;
+static uint32_t                 dns_seq;
+static osMutexId_t              dns_mutex;
+
+static const osMutexAttr_t dns_mutex_attr = {
+  "iotSocketDnsCache",
+  osMutexPrioInherit,
+  NULL,
+  0U
+};
+
+// Acquire cache lock (mutex is created on first use)
+static int32_t dns_lock (void) {
+  int32_t lock;
+
+  if (dns_mutex == NULL) {
+    lock = osKernelLock();
+    if (dns_mutex == NULL) {
+      dns_mutex = osMutexNew(&dns_mutex_attr);
+    }
+    osKernelRestoreLock(lock);
+    if (dns_mutex == NULL) {
+      return IOT_SOCKET_ERROR;
+    }
+  }
+  if (osMutexAcquire(dns_mutex, osWaitForever) != osOK) {
+    return IOT_SOCKET_ERROR;
+  }
+  return 0;
+}
+
+// Release cache lock
+static void dns_unlock (void) {
+  osMutexRelease(dns_mutex);
+}
+
+// Compare host names (case insensitive)
+static int32_t dns_name_equal (const char *a, const char *b) {
+  char ca, cb;
+
+  do {
+    ca = *a++;
+    cb = *b++;
+    if ((ca >= 'A') && (ca <= 'Z')) ca += 'a' - 'A';
+    if ((cb >= 'A') && (cb <= 'Z')) cb += 'a' - 'A';
+    if (ca != cb) {
+      return 0;
+    }
+  } while (ca != '\0');
+
+  return 1;
+}
+
+// Check if cache entry has expired
+static int32_t dns_expired (const dns_entry_t *entry, uint32_t now) {
+  return ((now - entry->stamp) >= entry->ttl) ? 1 : 0;
+}
+
+// Find a valid cache entry (called with lock held)
+static dns_entry_t *dns_find (const char *name, int32_t af, uint32_t now) {
+  uint32_t n;
+
+  for (n = 0U; n < IOT_SOCKET_DNS_CACHE_ENTRIES; n++) {
+    if ((dns_cache[n].af == (uint8_t)af) && dns_name_equal(dns_cache[n].name, name)) {
+      if (dns_expired(&dns_cache[n], now)) {
+        dns_cache[n].af = 0U;
+        return NULL;
+      }
+      return &dns_cache[n];
+    }
+  }
+  return NULL;
+}
+
+// Store resolver result into the cache (called with lock held)
+static void dns_store (const char *name, int32_t af, const uint8_t *ip, uint32_t ip_len, uint32_t ttl, uint32_t now) {
+  dns_entry_t *entry;
+  uint32_t n;
+
+  // Prefer an entry for the same name, then a free or expired one, then the least recently used one
+  entry = NULL;
+  for (n = 0U; n < IOT_SOCKET_DNS_CACHE_ENTRIES; n++) {
+    if ((dns_cache[n].af == (uint8_t)af) && dns_name_equal(dns_cache[n].name, name)) {
+      entry = &dns_cache[n];
+      break;
+    }
+  }
+  if (entry == NULL) {
+    for (n = 0U; n < IOT_SOCKET_DNS_CACHE_ENTRIES; n++) {
+      if ((dns_cache[n].af == 0U) || dns_expired(&dns_cache[n], now)) {
+        entry = &dns_cache[n];
+        break;
+      }
+    }
+  }
+  if (entry == NULL) {
+    entry = &dns_cache[0];
+    for (n = 1U; n < IOT_SOCKET_DNS_CACHE_ENTRIES; n++) {
+      if ((dns_seq - dns_cache[n].seq) > (dns_seq - entry->seq)) {
+        entry = &dns_cache[n];
+      }
+    }
+    dns_stats.evictions++;
+  }
+
+  if (ttl > IOT_SOCKET_DNS_CACHE_TTL_MAX) {
+    ttl = IOT_SOCKET_DNS_CACHE_TTL_MAX;
+  }
+
+  strcpy(entry->name, name);
+  entry->af     = (uint8_t)af;
+  entry->ip_len = (uint8_t)ip_len;
+  if (ip_len != 0U) {
+    memcpy(entry->ip, ip, ip_len);
+  }
+  entry->stamp  = now;
+  entry->ttl    = ttl * osKernelGetTickFreq();
+  entry->seq    = ++dns_seq;
+}
+
+// Retrieve host IP address from host name using the DNS cache
+int32_t iotSocketDnsCacheGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len) {
+  dns_entry_t *entry;
+  iotSocketAddr_t addr;
+  uint32_t count;
+  uint32_t ttl;
+  uint32_t now;
+  int32_t  rc;
+
+  // Check parameters
+  if ((name == NULL) || (ip == NULL) || (ip_len == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((af != IOT_SOCKET_AF_INET) && (af != IOT_SOCKET_AF_INET6)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if (strlen(name) >= IOT_SOCKET_DNS_CACHE_NAME_LEN) {
+    // Name does not fit into the cache
+    return iotSocketGetHostByName(name, af, ip, ip_len);
+  }
+
+  if (dns_lock() != 0) {
+    return IOT_SOCKET_ERROR;
+  }
+  now   = osKernelGetTickCount();
+  entry = dns_find(name, af, now);
+  if (entry != NULL) {
+    entry->seq = ++dns_seq;
+    if (entry->ip_len == 0U) {
+      dns_stats.neg_hits++;
+      rc = IOT_SOCKET_EHOSTNOTFOUND;
+    } else if (*ip_len < entry->ip_len) {
+      rc = IOT_SOCKET_EINVAL;
+    } else {
+      dns_stats.hits++;
+      memcpy(ip, entry->ip, entry->ip_len);
+      *ip_len = entry->ip_len;
+      rc = 0;
+    }
+    dns_unlock();
+    return rc;
+  }
+  dns_stats.misses++;
+  dns_unlock();
+
+  // Resolve hostname (lock is not held while the resolver blocks)
+  count = 1U;
+  ttl   = 0U;
+  rc = iotSocketGetAddrInfo(name, af, &addr, &count, &ttl);
+  if (rc == IOT_SOCKET_ENOTSUP) {
+    addr.ip_len = sizeof(addr.ip);
+    rc = iotSocketGetHostByName(name, af, addr.ip, &addr.ip_len);
+  }
+  if (ttl == 0U) {
+    // Record TTL not reported by the resolver
+    ttl = IOT_SOCKET_DNS_CACHE_TTL;
+  }
+
+  if ((rc == 0) || ((rc == IOT_SOCKET_EHOSTNOTFOUND) && (IOT_SOCKET_DNS_CACHE_NEG_TTL != 0))) {
+    if (dns_lock() == 0) {
+      now = osKernelGetTickCount();
+      if (rc == 0) {
+        dns_store(name, af, addr.ip, addr.ip_len, ttl, now);
+      } else {
+        dns_store(name, af, NULL, 0U, IOT_SOCKET_DNS_CACHE_NEG_TTL, now);
+      }
+      dns_unlock();
+    }
+  }
+
+  if (rc == 0) {
+    if (*ip_len < addr.ip_len) {
+      return IOT_SOCKET_EINVAL;
+    }
+    memcpy(ip, addr.ip, addr.ip_len);
+    *ip_len = addr.ip_len;
+  }
+
+  return rc;
+}
+
+// Remove entries from the DNS cache
+int32_t iotSocketDnsCacheFlush (const char *name) {
+  uint32_t n;
+
+  if (dns_lock() != 0) {
+    return IOT_SOCKET_ERROR;
+  }
+  for (n = 0U; n < IOT_SOCKET_DNS_CACHE_ENTRIES; n++) {
+    if ((name == NULL) || dns_name_equal(dns_cache[n].name, name)) {
+      dns_cache[n].af = 0U;
+    }
+  }
+  dns_unlock();
+
+  return 0;
+}
+
+// Retrieve DNS cache statistics
+int32_t iotSocketDnsCacheGetStats (iotSocketDnsCacheStats_t *stats) {
+
+  if (stats == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if (dns_lock() != 0) {
+    return IOT_SOCKET_ERROR;
+  }
+  memcpy(stats, &dns_stats, sizeof(dns_stats));
+  dns_unlock();
+
+  return 0;
+}
@@ -1,5 +1,5 @@
 /* -----------------------------------------------------------------------------
- * Copyright (c) 2022-2024 Arm Limited (or its affiliates). All rights reserved.
+ * Copyright (c) 2022-2026 Arm Limited (or its affiliates). All rights reserved.
  *
  * SPDX-License-Identifier: Apache-2.0
  *
@@ -17,10 +17,117 @@
  * -------------------------------------------------------------------------- */
 
 #include "iot_socket.h"
+#include "iot_socket_netif.h"
 
 #include "FreeRTOS_IP.h"
 #include "FreeRTOS_Sockets.h"
 
+/* Registered network interface extensions */
+static const iotSocketNetifApi_t *NetifApi = NULL;
+
+/* Maximum number of sockets */
+#ifndef IOT_SOCKET_NUM_SOCKS
+#define IOT_SOCKET_NUM_SOCKS            16
+#endif
+
+/* Socket flags */
+#define SOCKET_FLAG_BROADCAST           (1U << 0)       /* SO_BROADCAST enabled */
+#define SOCKET_FLAG_PRIORITY            (1U << 1)       /* SO_PRIORITY set for the local port */
+#define SOCKET_FLAG_TS_RX               (1U << 2)       /* SO_TIMESTAMP enabled for received datagrams */
+#define SOCKET_FLAG_TS_TX               (1U << 3)       /* SO_TIMESTAMP enabled for the local port */
+#define SOCKET_FLAG_NBIO                (1U << 4)       /* IO_FIONBIO non-blocking mode enabled */
+
+/* Socket attributes, socket id is the index into the table */
+static struct {
+  Socket_t   xSocket;           /* FreeRTOS+TCP socket (NULL = entry free) */
+  uint32_t   flags;             /* Socket flags */
+  int32_t    linger;            /* Linger time in seconds (-1 = disabled) */
+  TickType_t xRcvTimeout;       /* Receive timeout restored in blocking mode */
+  TickType_t xSndTimeout;       /* Send timeout restored in blocking mode */
+  uint16_t   usPort;            /* Local port of SOCKET_FLAG_PRIORITY and SOCKET_FLAG_TS_TX */
+} sock_attr[IOT_SOCKET_NUM_SOCKS];
+
+/* Allocate socket id for a FreeRTOS+TCP socket */
+static int32_t sock_alloc (Socket_t xSocket) {
+  int32_t socket;
+
+  taskENTER_CRITICAL();
+  for (socket = 0; socket < IOT_SOCKET_NUM_SOCKS; socket++) {
+    if (sock_attr[socket].xSocket == NULL) {
+      sock_attr[socket].xSocket     = xSocket;
+      sock_attr[socket].flags       = 0U;
+      sock_attr[socket].linger      = -1;
+      sock_attr[socket].xRcvTimeout = ipconfigSOCK_DEFAULT_RECEIVE_BLOCK_TIME;
+      sock_attr[socket].xSndTimeout = ipconfigSOCK_DEFAULT_SEND_BLOCK_TIME;
+      break;
+    }
+  }
+  taskEXIT_CRITICAL();
+
+  if (socket == IOT_SOCKET_NUM_SOCKS) {
+    /* Socket table is full */
+    (void)FreeRTOS_closesocket (xSocket);
+    socket = IOT_SOCKET_ENOMEM;
+  }
+
+  return socket;
+}
+
+/* Return FreeRTOS+TCP socket of a socket id (NULL = invalid socket) */
+static Socket_t sock_get (int32_t socket) {
+
+  if ((socket < 0) || (socket >= IOT_SOCKET_NUM_SOCKS)) {
+    return NULL;
+  }
+  return sock_attr[socket].xSocket;
+}
+
+/* Check if another socket holds the port setting of a flag for its local port */
+static uint32_t sock_port_shared (int32_t socket, uint16_t usPort, uint32_t flag) {
+  int32_t i;
+
+  for (i = 0; i < IOT_SOCKET_NUM_SOCKS; i++) {
+    if ((i != socket) && (sock_attr[i].xSocket != NULL) &&
+        (sock_attr[i].usPort == usPort) && ((sock_attr[i].flags & flag) != 0U)) {
+      return 1U;
+    }
+  }
+
+  return 0U;
+}
+
+/* Set or clear socket flags */
+static void sock_flags_set (int32_t socket, uint32_t flags, uint32_t enable) {
+
+  if (enable != 0U) {
+    sock_attr[socket].flags |=  flags;
+  } else {
+    sock_attr[socket].flags &= ~flags;
+  }
+}
+
+// Register network interface extensions
+int32_t iotSocketRegisterNetif (const iotSocketNetifApi_t *netif) {
+  NetifApi = netif;
+  return 0;
+}
+
+/* Return integer socket option value */
+static int32_t opt_int_get (void *opt_val, uint32_t *opt_len, int32_t value) {
+  int32_t stat;
+
+  if (*opt_len < sizeof(int32_t)) {
+    stat = IOT_SOCKET_EINVAL;
+  }
+  else {
+    memcpy (opt_val, &value, sizeof(value));
+    *opt_len = sizeof(int32_t);
+    stat = 0;
+  }
+
+  return stat;
+}
+
 // Create a communication socket
 int32_t iotSocketCreate (int32_t af, int32_t type, int32_t protocol) {
   BaseType_t xType;
@@ -49,7 +156,7 @@ int32_t iotSocketCreate (int32_t af, int32_t type, int32_t protocol) {
 
   if (xSocket != FREERTOS_INVALID_SOCKET) {
     /* Return socket id */
-    socket = (int32_t)xSocket;
+    socket = sock_alloc (xSocket);
   } else {
     /* Insufficient heap memory, socket was not created */
     socket = IOT_SOCKET_ENOMEM;
@@ -60,15 +167,20 @@ int32_t iotSocketCreate (int32_t af, int32_t type, int32_t protocol) {
 
 // Assign a local address to a socket
 int32_t iotSocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
-  Socket_t xSocket =(Socket_t)socket;
+  Socket_t xSocket = sock_get (socket);
   struct freertos_sockaddr pxAddress;
   BaseType_t rval;
   int32_t stat;
 
-  if ((ip == NULL) || (ip_len != 4U) || (port == 0U)) {
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  if ((ip == NULL) || (ip_len != 4U)) {
     return IOT_SOCKET_EINVAL;
   }
 
+  /* Port 0 binds to a free port from the private port range */
   pxAddress.sin_addr = FreeRTOS_inet_addr_quick (ip[0], ip[1], ip[2], ip[3]);
   pxAddress.sin_port = FreeRTOS_htons (port);
 
@@ -82,6 +194,10 @@ int32_t iotSocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint1
     /* Socket not bound, invalid socket or port number already used? */
     stat = IOT_SOCKET_EINVAL;
   }
+  else if (rval == -pdFREERTOS_ERRNO_EADDRINUSE) {
+    /* Port number already used */
+    stat = IOT_SOCKET_EADDRINUSE;
+  }
   else /* -pdFREERTOS_ERRNO_ECANCELED */ {
     /* Did not get a response from the IP task to the bind request */
     stat = IOT_SOCKET_ERROR;
@@ -92,10 +208,14 @@ int32_t iotSocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint1
 
 // Listen for socket connections
 int32_t iotSocketListen (int32_t socket, int32_t backlog) {
-  Socket_t xSocket =(Socket_t)socket;
+  Socket_t xSocket = sock_get (socket);
   BaseType_t rval;
   int32_t stat;
 
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
   rval = FreeRTOS_listen (xSocket, (BaseType_t)backlog);
 
   if (rval == 0) {
@@ -112,13 +232,17 @@ int32_t iotSocketListen (int32_t socket, int32_t backlog) {
 
 // Accept a new connection on a socket
 int32_t iotSocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
-  Socket_t xSocket =(Socket_t)socket;
+  Socket_t xSocket = sock_get (socket);
   struct freertos_sockaddr xAddress;
   socklen_t xAddressLength;
   Socket_t xAccept;
   int32_t sock;
   int32_t sin_addr_sz;
 
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
   xAddressLength = sizeof(struct freertos_sockaddr);
 
   xAccept = FreeRTOS_accept (xSocket, &xAddress, &xAddressLength);
@@ -132,10 +256,10 @@ int32_t iotSocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t
     sock = IOT_SOCKET_EINVAL;
   }
   else {
-    /* This is a handle to the new socket */
-    sock = (int32_t)xAccept;
+    /* Socket id of the new socket */
+    sock = sock_alloc (xAccept);
 
-    if ((ip != NULL) && (ip_len != NULL)) {
+    if ((sock >= 0) && (ip != NULL) && (ip_len != NULL)) {
       /* Copy remote IP address */
       sin_addr_sz = sizeof(xAddress.sin_addr);
 
@@ -145,7 +269,7 @@ int32_t iotSocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t
       }
     }
 
-    if (port != NULL) {
+    if ((sock >= 0) && (port != NULL)) {
       /* Copy remote port */
       *port = FreeRTOS_htons (xAddress.sin_port);
     }
@@ -156,11 +280,15 @@ int32_t iotSocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t
 
 // Connect a socket to a remote host
 int32_t iotSocketConnect (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
-  Socket_t xSocket =(Socket_t)socket;
+  Socket_t xSocket = sock_get (socket);
   struct freertos_sockaddr xAddress;
   BaseType_t rval;
   int32_t stat;
 
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
   if ((ip == NULL) || (port == 0U)) {
     return IOT_SOCKET_EINVAL;
   }
@@ -191,8 +319,8 @@ int32_t iotSocketConnect (int32_t socket, const uint8_t *ip, uint32_t ip_len, ui
     stat = IOT_SOCKET_ECONNABORTED;
   }
   else if (rval == -pdFREERTOS_ERRNO_EWOULDBLOCK) {
-    /* Operation would block */
-    stat = IOT_SOCKET_ECONNABORTED;
+    /* Non-blocking connect started */
+    stat = IOT_SOCKET_EINPROGRESS;
   }
   else if (rval == -pdFREERTOS_ERRNO_ETIMEDOUT) {
     /* Connect attempt timed out */
@@ -207,10 +335,14 @@ int32_t iotSocketConnect (int32_t socket, const uint8_t *ip, uint32_t ip_len, ui
 
 // Receive data on a connected socket
 int32_t iotSocketRecv (int32_t socket, void *buf, uint32_t len) {
-  Socket_t xSocket =(Socket_t)socket;
+  Socket_t xSocket = sock_get (socket);
   BaseType_t rval;
   int32_t stat;
 
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
   if (len == 0U) {
     /* Check if socket is readable */
     rval = FreeRTOS_recvcount (xSocket);
@@ -218,8 +350,18 @@ int32_t iotSocketRecv (int32_t socket, void *buf, uint32_t len) {
     if (rval == -pdFREERTOS_ERRNO_EINVAL) {
       /* Not a TCP socket */
       stat = IOT_SOCKET_EINVAL;
-    } else {
-      stat = (int32_t)rval;
+    }
+    else if (rval > 0) {
+      /* Data available */
+      stat = 0;
+    }
+    else if (FreeRTOS_issocketconnected (xSocket) == pdFALSE) {
+      /* Socket closing or closed */
+      stat = IOT_SOCKET_ENOTCONN;
+    }
+    else {
+      /* No data available */
+      stat = IOT_SOCKET_EAGAIN;
     }
   }
   else if (buf == NULL) {
@@ -256,13 +398,17 @@ int32_t iotSocketRecv (int32_t socket, void *buf, uint32_t len) {
 
 // Receive data on a socket
 int32_t iotSocketRecvFrom (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
-  Socket_t xSocket =(Socket_t)socket;
+  Socket_t xSocket = sock_get (socket);
   struct freertos_sockaddr xAddress;
   socklen_t xAddressLength;
   BaseType_t rval;
   int32_t stat;
   int32_t sin_addr_sz;
 
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
   if (len == 0U) {
     /* Check if socket is readable */
     rval = FreeRTOS_recvcount (xSocket);
@@ -270,8 +416,18 @@ int32_t iotSocketRecvFrom (int32_t socket, void *buf, uint32_t len, uint8_t *ip,
     if (rval == -pdFREERTOS_ERRNO_EINVAL) {
       /* Not a TCP socket */
       stat = IOT_SOCKET_EINVAL;
-    } else {
-      stat = (int32_t)rval;
+    }
+    else if (rval > 0) {
+      /* Data available */
+      stat = 0;
+    }
+    else if (FreeRTOS_issocketconnected (xSocket) == pdFALSE) {
+      /* Socket closing or closed */
+      stat = IOT_SOCKET_ENOTCONN;
+    }
+    else {
+      /* No data available */
+      stat = IOT_SOCKET_EAGAIN;
     }
   }
   else if (buf == NULL) {
@@ -324,12 +480,16 @@ int32_t iotSocketRecvFrom (int32_t socket, void *buf, uint32_t len, uint8_t *ip,
 
 // Send data on a connected socket
 int32_t iotSocketSend (int32_t socket, const void *buf, uint32_t len) {
-  Socket_t xSocket =(Socket_t)socket;
+  Socket_t xSocket = sock_get (socket);
   struct freertos_sockaddr xAddress;
   socklen_t xAddressLength;
   BaseType_t rval;
   int32_t stat;
 
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
   if (len == 0U) {
     /* Check if socket is writable */
     rval = FreeRTOS_maywrite (xSocket);
@@ -373,13 +533,38 @@ int32_t iotSocketSend (int32_t socket, const void *buf, uint32_t len) {
   return stat;
 }
 
+/* Get directed broadcast address of the network interface (network byte order) */
+static int32_t get_broadcast (uint32_t *pulAddress) {
+  uint32_t ulIPAddress;
+  uint32_t ulNetMask;
+  int32_t stat;
+
+  FreeRTOS_GetAddressConfiguration (&ulIPAddress, &ulNetMask, NULL, NULL);
+
+  if (ulIPAddress == 0U) {
+    /* Network interface is not configured */
+    stat = IOT_SOCKET_ENOTCONN;
+  }
+  else {
+    *pulAddress = ulIPAddress | ~ulNetMask;
+    stat = 0;
+  }
+
+  return stat;
+}
+
 // Send data on a socket
 int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
-  Socket_t xSocket =(Socket_t)socket;
+  Socket_t xSocket = sock_get (socket);
   struct freertos_sockaddr xAddress;
+  uint32_t ulBroadcast;
   BaseType_t rval;
   int32_t stat;
 
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
   if (len == 0U) {
     /* Check if socket is writable */
     rval = FreeRTOS_maywrite (xSocket);
@@ -395,193 +580,1088 @@ int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const ui
     stat = IOT_SOCKET_EINVAL;
   }
   else {
-    /* Write socket */
     xAddress.sin_addr = FreeRTOS_inet_addr_quick (ip[0], ip[1], ip[2], ip[3]);
     xAddress.sin_port = FreeRTOS_htons (port);
 
-    rval = FreeRTOS_sendto (xSocket, buf, len, 0U, &xAddress, sizeof(struct freertos_sockaddr));
+    /* FreeRTOS+TCP does not check SO_BROADCAST */
+    stat = 0;
+    if ((sock_attr[socket].flags & SOCKET_FLAG_BROADCAST) == 0U) {
+      if ((xAddress.sin_addr == ipBROADCAST_IP_ADDRESS) ||
+          ((get_broadcast (&ulBroadcast) == 0) && (xAddress.sin_addr == ulBroadcast))) {
+        stat = IOT_SOCKET_EINVAL;
+      }
+    }
+
+    if (stat == 0) {
+      /* Write socket */
+      rval = FreeRTOS_sendto (xSocket, buf, len, 0U, &xAddress, sizeof(struct freertos_sockaddr));
 
-    /* Number of bytes queued for sending, 0 on error or timeout */
-    stat = (int32_t)rval;
+      /* Number of bytes queued for sending, 0 on error or timeout */
+      stat = (int32_t)rval;
+    }
   }
   
   return stat;
 }
 
-// Retrieve local IP address and port of a socket
-int32_t iotSocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
-  Socket_t xSocket =(Socket_t)socket;
-  struct freertos_sockaddr xAddress;
-  size_t rval;
+// Receive data on a connected socket with message flags
+int32_t iotSocketRecvEx (int32_t socket, void *buf, uint32_t len, uint32_t flags) {
+  Socket_t xSocket = sock_get (socket);
+  BaseType_t xFlags;
+  BaseType_t rval;
+  uint8_t *pucPayload;
+  uint32_t num;
   int32_t stat;
 
-  if ((ip != NULL) && (*ip_len < sizeof(xAddress.sin_addr))) {
-    /* Not enough space to store IP address */
-    return IOT_SOCKET_EINVAL;
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
   }
 
-  /* Retrieve local IPv4 address */
-  (void)FreeRTOS_GetLocalAddress (xSocket, &xAddress);
-
-  if ((ip != NULL) && (ip_len != NULL) && (*ip_len >= sizeof(xAddress.sin_addr))) {
-    memcpy (ip, &xAddress.sin_addr, sizeof(xAddress.sin_addr));
+  if ((flags & ~(IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_DONTWAIT | IOT_SOCKET_MSG_WAITALL | IOT_SOCKET_MSG_TRUNC)) != 0U) {
+    stat = IOT_SOCKET_EINVAL;
   }
-
-  if (port != NULL) {
-    *port = FreeRTOS_ntohs (xAddress.sin_port);
+  else if ((flags & (IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_WAITALL)) == (IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_WAITALL)) {
+    stat = IOT_SOCKET_EINVAL;
   }
-
-  return 0U;
-}
-
-// Retrieve remote IP address and port of a socket
-int32_t iotSocketGetPeerName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
-  Socket_t xSocket =(Socket_t)socket;
-  struct freertos_sockaddr xAddress;
-  size_t rval;
-  int32_t stat;
-
-  if ((ip != NULL) && (*ip_len < sizeof(xAddress.sin_addr))) {
-    /* Not enough space to store IP address */
-    return IOT_SOCKET_EINVAL;
+  else if (len == 0U) {
+    /* Check if socket is readable */
+    stat = iotSocketRecv (socket, buf, 0U);
   }
-
-  /* Retrieve remote IPv4 address */
-  if (FreeRTOS_GetRemoteAddress (xSocket, &xAddress) == -pdFREERTOS_ERRNO_EINVAL) {
-    /* Not a TCP socket */
-    stat = IOT_SOCKET_ESOCK;
+  else if (buf == NULL) {
+    stat = IOT_SOCKET_EINVAL;
   }
   else {
-    stat = 0U;
+    xFlags = 0;
+    if ((flags & IOT_SOCKET_MSG_PEEK) != 0U) {
+      xFlags |= FREERTOS_MSG_PEEK;
+    }
+    if ((flags & IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+      xFlags |= FREERTOS_MSG_DONTWAIT;
+    }
 
-    /* Copy IP address and port */
-    if ((ip != NULL) && (ip_len != NULL) && (*ip_len >= sizeof(xAddress.sin_addr))) {
-      memcpy (ip, &xAddress.sin_addr, sizeof(xAddress.sin_addr));
+    if (FreeRTOS_issocketconnected (xSocket) == -pdFREERTOS_ERRNO_EINVAL) {
+      /* UDP socket, zero copy receive provides the real datagram length */
+      rval = FreeRTOS_recvfrom (xSocket, &pucPayload, 0U, xFlags | FREERTOS_ZERO_COPY, NULL, NULL);
+
+      if (rval > 0) {
+        memcpy (buf, pucPayload, ((uint32_t)rval < len) ? (uint32_t)rval : len);
+
+        if ((flags & IOT_SOCKET_MSG_PEEK) == 0U) {
+          /* Datagram was removed from the receive queue */
+          FreeRTOS_ReleaseUDPPayloadBuffer (pucPayload);
+        }
+        if (((flags & IOT_SOCKET_MSG_TRUNC) == 0U) && ((uint32_t)rval > len)) {
+          rval = (BaseType_t)len;
+        }
+        stat = (int32_t)rval;
+      }
+      else if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+        /* Socket not bound? */
+        stat = IOT_SOCKET_ENOTCONN;
+      }
+      else if (rval == -pdFREERTOS_ERRNO_EINTR) {
+        /* Read operation aborted */
+        stat = IOT_SOCKET_ECONNABORTED;
+      }
+      else {
+        /* No datagram received, block time expired */
+        stat = IOT_SOCKET_EAGAIN;
+      }
     }
+    else {
+      /* TCP socket, repeat until buffer is full with MSG_WAITALL */
+      num = 0U;
+      do {
+        rval = FreeRTOS_recv (xSocket, (uint8_t *)buf + num, len - num, xFlags);
+        if (rval <= 0) {
+          break;
+        }
+        num += (uint32_t)rval;
+      } while (((flags & IOT_SOCKET_MSG_WAITALL) != 0U) && (num < len));
 
-    if (port != NULL) {
-      *port = FreeRTOS_ntohs (xAddress.sin_port);
+      if (num != 0U) {
+        /* Number of bytes received, error is reported on the next call */
+        stat = (int32_t)num;
+      }
+      else if ((rval == 0) || (rval == -pdFREERTOS_ERRNO_EWOULDBLOCK)) {
+        /* No bytes received, block time expired */
+        stat = IOT_SOCKET_EAGAIN;
+      }
+      else if (rval == -pdFREERTOS_ERRNO_ENOTCONN) {
+        /* Socket closing or closed */
+        stat = IOT_SOCKET_ENOTCONN;
+      }
+      else if (rval == -pdFREERTOS_ERRNO_EINTR) {
+        /* Read operation aborted */
+        stat = IOT_SOCKET_ECONNABORTED;
+      }
+      else if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+        /* Socket not valid */
+        stat = IOT_SOCKET_ESOCK;
+      }
+      else {
+        /* Not enough memory to create rx stream */
+        stat = IOT_SOCKET_ERROR;
+      }
     }
   }
 
   return stat;
 }
 
-// Get socket option
-int32_t iotSocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, uint32_t *opt_len) {
-  Socket_t xSocket =(Socket_t)socket;
+// Send data on a connected socket with message flags
+int32_t iotSocketSendEx (int32_t socket, const void *buf, uint32_t len, uint32_t flags) {
+  Socket_t xSocket = sock_get (socket);
   BaseType_t rval;
   int32_t stat;
 
-  if ((opt_val == NULL) || (opt_len == NULL) || (*opt_len == 0)) {
-    stat = IOT_SOCKET_EINVAL;
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
   }
-  else if (opt_id == IOT_SOCKET_SO_RCVTIMEO) {
-    stat = IOT_SOCKET_ENOTSUP;
+
+  if ((flags & ~IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+    stat = IOT_SOCKET_EINVAL;
   }
-  else if (opt_id == IOT_SOCKET_SO_SNDTIMEO) {
-    stat = IOT_SOCKET_ENOTSUP;
+  else if ((len == 0U) || ((flags & IOT_SOCKET_MSG_DONTWAIT) == 0U)) {
+    /* Check if socket is writable or send with socket timeout */
+    stat = iotSocketSend (socket, buf, len);
   }
-  else if (opt_id == IOT_SOCKET_SO_KEEPALIVE) {
-    stat = IOT_SOCKET_ENOTSUP;
+  else if (buf == NULL) {
+    stat = IOT_SOCKET_EINVAL;
   }
-  else if (opt_id == IOT_SOCKET_SO_TYPE) {
-    /* Misuse issocketconnected to determine if this is TCP or UDP socket */
-    rval = FreeRTOS_issocketconnected (xSocket);
+  else {
+    /* Write socket without blocking */
+    rval = FreeRTOS_send (xSocket, buf, len, FREERTOS_MSG_DONTWAIT);
 
-    if (rval == -pdFREERTOS_ERRNO_EINVAL) {
-      /* This is UDP socket */
-      stat = IOT_SOCKET_SOCK_DGRAM;
-    } else {
-      /* This is TCP socket */
-      stat = IOT_SOCKET_SOCK_STREAM;
+    if (rval == -pdFREERTOS_ERRNO_ENOTCONN) {
+      /* Socket closing or closed */
+      stat = IOT_SOCKET_ENOTCONN;
+    }
+    else if (rval == -pdFREERTOS_ERRNO_ENOMEM) {
+      /* Not enough memory to send data */
+      stat = IOT_SOCKET_ERROR;
+    }
+    else if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+      /* Socket not valid or not a TCP socket */
+      stat = IOT_SOCKET_ESOCK;
+    }
+    else if ((rval == 0) || (rval == -pdFREERTOS_ERRNO_ENOSPC)) {
+      /* No space in the transmit stream */
+      stat = IOT_SOCKET_EAGAIN;
+    }
+    else {
+      /* Number of bytes sent */
+      stat = (int32_t)rval;
     }
-  }
-  else {
-    stat = IOT_SOCKET_EINVAL;
   }
 
   return stat;
 }
 
-// Set socket option
-int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, uint32_t opt_len) {
-  Socket_t xSocket =(Socket_t)socket;
-  BaseType_t rval;
-  TickType_t xTimeout;
-  int32_t stat;
+/* Start a timed call: the socket blocks at most for the time budget */
+static void timed_start (int32_t socket, uint32_t timeout, TimeOut_t *pxTimeOut, TickType_t *pxTicks) {
+  Socket_t xSocket = sock_attr[socket].xSocket;
 
-  if ((opt_val == NULL) || (opt_len == 0U)) {
-    stat = IOT_SOCKET_EINVAL;
-  }
-  else if (opt_id == IOT_SOCKET_IO_FIONBIO) {
-    /* Set non-blocking I/O (default = 0) */
-    /* opt_val = &nbio, opt_len = sizeof(nbio), nbio (integer): 0=blocking, non-blocking otherwise */
-    if (opt_len != sizeof(unsigned long)) {
-      stat = IOT_SOCKET_EINVAL;
-    }
-    else {
-      xTimeout = 0U;
+  *pxTicks = pdMS_TO_TICKS (timeout);
+  vTaskSetTimeOutState (pxTimeOut);
 
-      /* Set receive and send timeout to zero */
-      rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_RCVTIMEO, &xTimeout, sizeof(xTimeout));
+  /* FreeRTOS+TCP takes the block time of all calls from the socket timeouts */
+  (void)FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_RCVTIMEO, pxTicks, sizeof(TickType_t));
+  (void)FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_SNDTIMEO, pxTicks, sizeof(TickType_t));
+}
 
-      if (rval == 0) {
-        rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_SNDTIMEO, &xTimeout, sizeof(xTimeout));
-      }
+/* End a timed call: restore the socket timeouts and return the time left in ms */
+static void timed_end (int32_t socket, TimeOut_t *pxTimeOut, TickType_t *pxTicks, uint32_t *timeout) {
+  Socket_t xSocket = sock_attr[socket].xSocket;
+  TickType_t xRcvTimeout;
+  TickType_t xSndTimeout;
 
-      if (rval == -pdFREERTOS_ERRNO_EINVAL) {
-        stat = IOT_SOCKET_EINVAL;
-      } else {
-        stat = 0U;
-      }
-    }
+  if ((sock_attr[socket].flags & SOCKET_FLAG_NBIO) != 0U) {
+    xRcvTimeout = 0U;
+    xSndTimeout = 0U;
+  } else {
+    xRcvTimeout = sock_attr[socket].xRcvTimeout;
+    xSndTimeout = sock_attr[socket].xSndTimeout;
   }
-  else if (opt_id == IOT_SOCKET_SO_RCVTIMEO) {
-    /* Receive timeout in ms (default = 0) */
-    /* opt_val = &timeout, opt_len = sizeof(timeout) */
-    memcpy (&xTimeout, opt_val, opt_len);
+  (void)FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_RCVTIMEO, &xRcvTimeout, sizeof(xRcvTimeout));
+  (void)FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_SNDTIMEO, &xSndTimeout, sizeof(xSndTimeout));
 
-    /* 0 timeout is wait forever (Berkeley sockets) */
-    if (xTimeout == 0) {
-      xTimeout = portMAX_DELAY;
-    }
+  if (xTaskCheckForTimeOut (pxTimeOut, pxTicks) != pdFALSE) {
+    *pxTicks = 0U;
+  }
+  *timeout = (uint32_t)*pxTicks * portTICK_PERIOD_MS;
+}
 
-    /* Set receive timeout */
-    rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_RCVTIMEO, &xTimeout, sizeof(xTimeout));
+// Accept a new connection on a socket within a time budget
+int32_t iotSocketAcceptTimed (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port, uint32_t *timeout) {
+  TimeOut_t xTimeOut;
+  TickType_t xTicks;
+  int32_t stat;
 
-    if (rval == -pdFREERTOS_ERRNO_EINVAL) {
-      stat = IOT_SOCKET_EINVAL;
-    } else {
-      stat = 0U;
-    }
+  if (sock_get (socket) == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if (timeout == NULL) {
+    return IOT_SOCKET_EINVAL;
   }
-  else if (opt_id == IOT_SOCKET_SO_SNDTIMEO) {
-    /* Send timeout in ms (default = 0) */
-    /* opt_val = &timeout, opt_len = sizeof(timeout) */
-    memcpy (&xTimeout, opt_val, opt_len);
 
-    /* 0 timeout is wait forever (Berkeley sockets) */
-    if (xTimeout == 0) {
-      xTimeout = portMAX_DELAY;
-    }
+  timed_start (socket, *timeout, &xTimeOut, &xTicks);
 
-    /* Set send timeout */
-    rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_SNDTIMEO, &xTimeout, sizeof(xTimeout));
+  stat = iotSocketAccept (socket, ip, ip_len, port);
+  if (stat == IOT_SOCKET_EAGAIN) {
+    /* No connection request within the time budget */
+    stat = IOT_SOCKET_ETIMEDOUT;
+  }
 
-    if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+  timed_end (socket, &xTimeOut, &xTicks, timeout);
+
+  return stat;
+}
+
+// Connect a socket to a remote host within a time budget
+int32_t iotSocketConnectTimed (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port, uint32_t *timeout) {
+  TimeOut_t xTimeOut;
+  TickType_t xTicks;
+  int32_t stat;
+
+  if (sock_get (socket) == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if (timeout == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  timed_start (socket, *timeout, &xTimeOut, &xTicks);
+
+  stat = iotSocketConnect (socket, ip, ip_len, port);
+  if ((stat == IOT_SOCKET_EINPROGRESS) || (stat == IOT_SOCKET_EALREADY)) {
+    /* Connection not established within the time budget, attempt is still pending */
+    stat = IOT_SOCKET_ETIMEDOUT;
+  }
+  else if (stat == IOT_SOCKET_EISCONN) {
+    stat = 0;
+  }
+
+  timed_end (socket, &xTimeOut, &xTicks, timeout);
+
+  return stat;
+}
+
+// Receive data on a connected socket within a time budget
+int32_t iotSocketRecvTimed (int32_t socket, void *buf, uint32_t len, uint32_t *timeout) {
+  TimeOut_t xTimeOut;
+  TickType_t xTicks;
+  int32_t stat;
+
+  if (sock_get (socket) == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((buf == NULL) || (len == 0U) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  timed_start (socket, *timeout, &xTimeOut, &xTicks);
+
+  stat = iotSocketRecvEx (socket, buf, len, 0U);
+  if (stat == IOT_SOCKET_EAGAIN) {
+    /* No data within the time budget */
+    stat = IOT_SOCKET_ETIMEDOUT;
+  }
+
+  timed_end (socket, &xTimeOut, &xTicks, timeout);
+
+  return stat;
+}
+
+// Send data on a connected socket within a time budget
+int32_t iotSocketSendTimed (int32_t socket, const void *buf, uint32_t len, uint32_t *timeout) {
+  TimeOut_t xTimeOut;
+  TickType_t xTicks;
+  int32_t stat;
+
+  if (sock_get (socket) == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((buf == NULL) || (len == 0U) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  timed_start (socket, *timeout, &xTimeOut, &xTicks);
+
+  stat = iotSocketSendEx (socket, buf, len, 0U);
+  if (stat == IOT_SOCKET_EAGAIN) {
+    /* No space in the transmit stream within the time budget */
+    stat = IOT_SOCKET_ETIMEDOUT;
+  }
+
+  timed_end (socket, &xTimeOut, &xTicks, timeout);
+
+  return stat;
+}
+
+// Receive data on a socket together with its receive timestamp
+int32_t iotSocketRecvFromTs (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port, iotSocketTimestamp_t *ts) {
+  Socket_t xSocket = sock_get (socket);
+  struct freertos_sockaddr xAddress;
+  socklen_t xAddressLength;
+  BaseType_t rval;
+  uint8_t *pucPayload;
+  int32_t stat;
+  int32_t sin_addr_sz;
+
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  if ((buf == NULL) || (len == 0U) || (ts == NULL)) {
+    stat = IOT_SOCKET_EINVAL;
+  }
+  else if (FreeRTOS_issocketconnected (xSocket) != -pdFREERTOS_ERRNO_EINVAL) {
+    /* TCP socket, stream data has no timestamp */
+    memset (ts, 0, sizeof(iotSocketTimestamp_t));
+    stat = iotSocketRecvFrom (socket, buf, len, ip, ip_len, port);
+  }
+  else {
+    /* UDP socket, zero copy receive keeps the network buffer holding the timestamp */
+    memset (ts, 0, sizeof(iotSocketTimestamp_t));
+    xAddressLength = sizeof(struct freertos_sockaddr);
+
+    rval = FreeRTOS_recvfrom (xSocket, &pucPayload, 0U, FREERTOS_ZERO_COPY, &xAddress, &xAddressLength);
+
+    if (rval > 0) {
+      memcpy (buf, pucPayload, ((uint32_t)rval < len) ? (uint32_t)rval : len);
+
+      if (((sock_attr[socket].flags & SOCKET_FLAG_TS_RX) != 0U) && (NetifApi != NULL)) {
+        /* Timestamp is left cleared for datagrams not received by the network interface */
+        (void)NetifApi->GetRxTimestamp (pxUDPPayloadBuffer_to_NetworkBuffer (pucPayload), ts);
+      }
+      FreeRTOS_ReleaseUDPPayloadBuffer (pucPayload);
+
+      if ((uint32_t)rval > len) {
+        /* Datagram truncated */
+        rval = (BaseType_t)len;
+      }
+      stat = (int32_t)rval;
+
+      if ((ip != NULL) && (ip_len != NULL)) {
+        /* Copy remote IP address */
+        sin_addr_sz = sizeof(xAddress.sin_addr);
+
+        if (*ip_len >= sin_addr_sz) {
+          memcpy (ip, &xAddress.sin_addr, sin_addr_sz);
+          *ip_len = sin_addr_sz;
+        }
+      }
+
+      if (port != NULL) {
+        /* Copy remote port */
+        *port = FreeRTOS_htons (xAddress.sin_port);
+      }
+    }
+    else if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+      /* Socket not bound? */
+      stat = IOT_SOCKET_ENOTCONN;
+    }
+    else if (rval == -pdFREERTOS_ERRNO_EINTR) {
+      /* Read operation aborted */
+      stat = IOT_SOCKET_ECONNABORTED;
+    }
+    else {
+      /* No datagram received, block time expired */
+      stat = IOT_SOCKET_EAGAIN;
+    }
+  }
+
+  return stat;
+}
+
+// Retrieve local IP address and port of a socket
+int32_t iotSocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  Socket_t xSocket = sock_get (socket);
+  struct freertos_sockaddr xAddress;
+  size_t rval;
+  int32_t stat;
+
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  if ((ip != NULL) && (*ip_len < sizeof(xAddress.sin_addr))) {
+    /* Not enough space to store IP address */
+    return IOT_SOCKET_EINVAL;
+  }
+
+  /* Retrieve local IPv4 address */
+  (void)FreeRTOS_GetLocalAddress (xSocket, &xAddress);
+
+  if ((ip != NULL) && (ip_len != NULL) && (*ip_len >= sizeof(xAddress.sin_addr))) {
+    memcpy (ip, &xAddress.sin_addr, sizeof(xAddress.sin_addr));
+  }
+
+  if (port != NULL) {
+    *port = FreeRTOS_ntohs (xAddress.sin_port);
+  }
+
+  return 0U;
+}
+
+// Retrieve remote IP address and port of a socket
+int32_t iotSocketGetPeerName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
+  Socket_t xSocket = sock_get (socket);
+  struct freertos_sockaddr xAddress;
+  size_t rval;
+  int32_t stat;
+
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  if ((ip != NULL) && (*ip_len < sizeof(xAddress.sin_addr))) {
+    /* Not enough space to store IP address */
+    return IOT_SOCKET_EINVAL;
+  }
+
+  /* Retrieve remote IPv4 address */
+  if (FreeRTOS_GetRemoteAddress (xSocket, &xAddress) == -pdFREERTOS_ERRNO_EINVAL) {
+    /* Not a TCP socket */
+    stat = IOT_SOCKET_ESOCK;
+  }
+  else {
+    stat = 0U;
+
+    /* Copy IP address and port */
+    if ((ip != NULL) && (ip_len != NULL) && (*ip_len >= sizeof(xAddress.sin_addr))) {
+      memcpy (ip, &xAddress.sin_addr, sizeof(xAddress.sin_addr));
+    }
+
+    if (port != NULL) {
+      *port = FreeRTOS_ntohs (xAddress.sin_port);
+    }
+  }
+
+  return stat;
+}
+
+// Get socket option
+int32_t iotSocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, uint32_t *opt_len) {
+  Socket_t xSocket = sock_get (socket);
+  struct freertos_sockaddr xAddress;
+  iotSocketTimestamp_t xTs;
+  uint32_t ts;
+  uint8_t *pucPayload;
+  BaseType_t rval;
+  int32_t stat;
+
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  if ((opt_val == NULL) || (opt_len == NULL) || (*opt_len == 0)) {
+    stat = IOT_SOCKET_EINVAL;
+  }
+  else if (opt_id == IOT_SOCKET_SO_RCVTIMEO) {
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_SO_SNDTIMEO) {
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_SO_KEEPALIVE) {
+#if (ipconfigTCP_KEEP_ALIVE == 1)
+    stat = opt_int_get (opt_val, opt_len, 1);
+#else
+    stat = opt_int_get (opt_val, opt_len, 0);
+#endif
+  }
+  else if (opt_id == IOT_SOCKET_TCP_KEEPIDLE) {
+#if (ipconfigTCP_KEEP_ALIVE == 1)
+    stat = opt_int_get (opt_val, opt_len, ipconfigTCP_KEEP_ALIVE_INTERVAL);
+#else
+    stat = IOT_SOCKET_ENOTSUP;
+#endif
+  }
+  else if (opt_id == IOT_SOCKET_TCP_KEEPINTVL) {
+#if (ipconfigTCP_KEEP_ALIVE == 1)
+    /* Not configurable, prvTCPPrepareSend of FreeRTOS+TCP repeats unanswered probes every 3 seconds */
+    stat = opt_int_get (opt_val, opt_len, 3);
+#else
+    stat = IOT_SOCKET_ENOTSUP;
+#endif
+  }
+  else if (opt_id == IOT_SOCKET_TCP_KEEPCNT) {
+#if (ipconfigTCP_KEEP_ALIVE == 1)
+    /* Not configurable, prvTCPPrepareSend of FreeRTOS+TCP drops the connection after 3 unanswered probes */
+    stat = opt_int_get (opt_val, opt_len, 3);
+#else
+    stat = IOT_SOCKET_ENOTSUP;
+#endif
+  }
+  else if (opt_id == IOT_SOCKET_TCP_NODELAY) {
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_TCP_CORK) {
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_SO_RCVBUF) {
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_SO_SNDBUF) {
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_TCP_WINDOW) {
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_IP_TOS) {
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_SO_PRIORITY) {
+    if ((NetifApi == NULL) || (NetifApi->GetTxPriority == NULL)) {
+      /* Network interface does not prioritize frames */
+      stat = IOT_SOCKET_ENOTSUP;
+    }
+    else {
+      (void)FreeRTOS_GetLocalAddress (xSocket, &xAddress);
+      stat = opt_int_get (opt_val, opt_len, NetifApi->GetTxPriority (FreeRTOS_ntohs (xAddress.sin_port)));
+    }
+  }
+  else if (opt_id == IOT_SOCKET_SO_BROADCAST) {
+    stat = opt_int_get (opt_val, opt_len, ((sock_attr[socket].flags & SOCKET_FLAG_BROADCAST) != 0U) ? 1 : 0);
+  }
+  else if (opt_id == IOT_SOCKET_SO_LINGER) {
+    stat = opt_int_get (opt_val, opt_len, sock_attr[socket].linger);
+  }
+  else if (opt_id == IOT_SOCKET_SO_REUSEADDR) {
+    /* Address reuse is always enabled */
+    stat = opt_int_get (opt_val, opt_len, 1);
+  }
+  else if (opt_id == IOT_SOCKET_IO_FIONREAD) {
+    rval = FreeRTOS_recvcount (xSocket);
+
+    if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+      /* UDP socket, peek at the next datagram to get its length */
+      rval = FreeRTOS_recvfrom (xSocket, &pucPayload, 0U,
+                                FREERTOS_ZERO_COPY | FREERTOS_MSG_PEEK | FREERTOS_MSG_DONTWAIT, NULL, NULL);
+      if (rval < 0) {
+        /* No datagram received */
+        rval = 0;
+      }
+    }
+    stat = opt_int_get (opt_val, opt_len, (int32_t)rval);
+  }
+  else if (opt_id == IOT_SOCKET_SO_TIMESTAMP) {
+    if ((NetifApi == NULL) || (NetifApi->SetTxTimestamp == NULL)) {
+      /* Network interface does not timestamp frames */
+      stat = IOT_SOCKET_ENOTSUP;
+    }
+    else {
+      ts = 0U;
+      if ((sock_attr[socket].flags & SOCKET_FLAG_TS_RX) != 0U) {
+        ts |= IOT_SOCKET_TIMESTAMP_RX;
+      }
+      if ((sock_attr[socket].flags & SOCKET_FLAG_TS_TX) != 0U) {
+        ts |= IOT_SOCKET_TIMESTAMP_TX;
+      }
+      stat = opt_int_get (opt_val, opt_len, (int32_t)ts);
+    }
+  }
+  else if (opt_id == IOT_SOCKET_SO_TIMESTAMP_TX) {
+    if ((NetifApi == NULL) || (NetifApi->GetTxTimestamp == NULL)) {
+      /* Network interface does not timestamp frames */
+      stat = IOT_SOCKET_ENOTSUP;
+    }
+    else if ((*opt_len < sizeof(iotSocketTimestamp_t)) || ((sock_attr[socket].flags & SOCKET_FLAG_TS_TX) == 0U)) {
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      (void)FreeRTOS_GetLocalAddress (xSocket, &xAddress);
+
+      if (NetifApi->GetTxTimestamp (FreeRTOS_ntohs (xAddress.sin_port), &xTs) != 0) {
+        /* No datagram timestamped yet */
+        stat = IOT_SOCKET_EAGAIN;
+      }
+      else {
+        memcpy (opt_val, &xTs, sizeof(xTs));
+        *opt_len = sizeof(iotSocketTimestamp_t);
+        stat = 0;
+      }
+    }
+  }
+  else if ((opt_id == IOT_SOCKET_IP_MULTICAST_TTL)    || (opt_id == IOT_SOCKET_IP_MULTICAST_LOOP) ||
+           (opt_id == IOT_SOCKET_IPV6_MULTICAST_HOPS) || (opt_id == IOT_SOCKET_IPV6_MULTICAST_LOOP)) {
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_SO_TYPE) {
+    /* Misuse issocketconnected to determine if this is TCP or UDP socket */
+    rval = FreeRTOS_issocketconnected (xSocket);
+
+    if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+      /* This is UDP socket */
+      stat = IOT_SOCKET_SOCK_DGRAM;
+    } else {
+      /* This is TCP socket */
+      stat = IOT_SOCKET_SOCK_STREAM;
+    }
+  }
+  else {
+    stat = IOT_SOCKET_EINVAL;
+  }
+
+  return stat;
+}
+
+// Set socket option
+int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, uint32_t opt_len) {
+  Socket_t xSocket = sock_get (socket);
+  BaseType_t rval;
+  BaseType_t xValue;
+  TickType_t xTimeout;
+  struct freertos_sockaddr xAddress;
+  uint32_t ts;
+#if (ipconfigUSE_TCP_WIN == 1)
+  WinProperties_t xWinProperties;
+  uint32_t ulSize;
+#endif
+#ifdef FREERTOS_SO_IP_ADD_MEMBERSHIP
+  struct freertos_ip_mreq xMReq;
+  uint8_t ucMAC[6];
+#endif
+#ifdef FREERTOS_SO_IP_MULTICAST_TTL
+  uint8_t ucTTL;
+#endif
+  int32_t stat;
+
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  if ((opt_val == NULL) || (opt_len == 0U)) {
+    stat = IOT_SOCKET_EINVAL;
+  }
+  else if (opt_id == IOT_SOCKET_IO_FIONBIO) {
+    /* Set non-blocking I/O (default = 0) */
+    /* opt_val = &nbio, opt_len = sizeof(nbio), nbio (integer): 0=blocking, non-blocking otherwise */
+    if (opt_len != sizeof(unsigned long)) {
       stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      /* Non-blocking: set receive and send timeout to zero */
+      /* Blocking: restore receive and send timeout of the socket */
+      if (*(const unsigned long *)opt_val != 0U) {
+        xTimeout = 0U;
+      } else {
+        xTimeout = sock_attr[socket].xRcvTimeout;
+      }
+      rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_RCVTIMEO, &xTimeout, sizeof(xTimeout));
+
+      if (rval == 0) {
+        if (*(const unsigned long *)opt_val == 0U) {
+          xTimeout = sock_attr[socket].xSndTimeout;
+        }
+        rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_SNDTIMEO, &xTimeout, sizeof(xTimeout));
+      }
+
+      if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+        stat = IOT_SOCKET_EINVAL;
+      } else {
+        sock_flags_set (socket, SOCKET_FLAG_NBIO, (*(const unsigned long *)opt_val != 0U) ? 1U : 0U);
+        stat = 0U;
+      }
+    }
+  }
+  else if (opt_id == IOT_SOCKET_SO_RCVTIMEO) {
+    /* Receive timeout in ms (default = 0) */
+    /* opt_val = &timeout, opt_len = sizeof(timeout) */
+    memcpy (&xTimeout, opt_val, opt_len);
+
+    /* 0 timeout is wait forever (Berkeley sockets) */
+    if (xTimeout == 0) {
+      xTimeout = portMAX_DELAY;
+    }
+
+    /* Set receive timeout, non-blocking mode applies it when cleared */
+    if ((sock_attr[socket].flags & SOCKET_FLAG_NBIO) == 0U) {
+      rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_RCVTIMEO, &xTimeout, sizeof(xTimeout));
+    } else {
+      rval = 0;
+    }
+
+    if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+      stat = IOT_SOCKET_EINVAL;
+    } else {
+      sock_attr[socket].xRcvTimeout = xTimeout;
+      stat = 0U;
+    }
+  }
+  else if (opt_id == IOT_SOCKET_SO_SNDTIMEO) {
+    /* Send timeout in ms (default = 0) */
+    /* opt_val = &timeout, opt_len = sizeof(timeout) */
+    memcpy (&xTimeout, opt_val, opt_len);
+
+    /* 0 timeout is wait forever (Berkeley sockets) */
+    if (xTimeout == 0) {
+      xTimeout = portMAX_DELAY;
+    }
+
+    /* Set send timeout, non-blocking mode applies it when cleared */
+    if ((sock_attr[socket].flags & SOCKET_FLAG_NBIO) == 0U) {
+      rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_SNDTIMEO, &xTimeout, sizeof(xTimeout));
     } else {
+      rval = 0;
+    }
+
+    if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+      stat = IOT_SOCKET_EINVAL;
+    } else {
+      sock_attr[socket].xSndTimeout = xTimeout;
       stat = 0U;
     }
   }
   else if (opt_id == IOT_SOCKET_SO_KEEPALIVE) {
     /* Keep-alive messages (default = 0) */
     /* opt_val = &keepalive, opt_len = sizeof(keepalive), keepalive (integer): 0=disabled, enabled otherwise */
+    /* Keep-alive is a global setting (ipconfigTCP_KEEP_ALIVE) */
+    if (opt_len != sizeof(int32_t)) {
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else if ((*(const int32_t *)opt_val != 0) == (ipconfigTCP_KEEP_ALIVE == 1)) {
+      stat = 0;
+    }
+    else {
+      /* Value cannot be changed per socket */
+      stat = IOT_SOCKET_ENOTSUP;
+    }
+  }
+  else if ((opt_id == IOT_SOCKET_TCP_KEEPIDLE)  ||
+           (opt_id == IOT_SOCKET_TCP_KEEPINTVL) ||
+           (opt_id == IOT_SOCKET_TCP_KEEPCNT))  {
+    /* Keep-alive timing is global in FreeRTOS+TCP (ipconfigTCP_KEEP_ALIVE_INTERVAL)
+       and cannot be set per socket */
     stat = IOT_SOCKET_ENOTSUP;
   }
-  else {
+  else if (opt_id == IOT_SOCKET_IP_TOS) {
+    /* IPv4 type of service is not provided by FreeRTOS+TCP */
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_SO_PRIORITY) {
+    /* Transmit priority (default = 0) */
+    /* opt_val = &priority, opt_len = sizeof(priority), priority (integer): 0=normal, 1..7=high */
+    if ((NetifApi == NULL) || (NetifApi->SetTxPriority == NULL)) {
+      /* Network interface does not prioritize frames */
+      stat = IOT_SOCKET_ENOTSUP;
+    }
+    else if ((opt_len != sizeof(int32_t)) || (*(const int32_t *)opt_val < 0) || (*(const int32_t *)opt_val > 7)) {
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      /* Network interface prioritizes frames by local port, socket must be bound */
+      (void)FreeRTOS_GetLocalAddress (xSocket, &xAddress);
+
+      if (xAddress.sin_port == 0U) {
+        stat = IOT_SOCKET_EINVAL;
+      }
+      else {
+        sock_attr[socket].usPort = FreeRTOS_ntohs (xAddress.sin_port);
+        stat = 0;
+
+        /* Port priority is kept while other sockets of the port use it */
+        if ((*(const int32_t *)opt_val != 0) ||
+            (sock_port_shared (socket, sock_attr[socket].usPort, SOCKET_FLAG_PRIORITY) == 0U)) {
+          if (NetifApi->SetTxPriority (sock_attr[socket].usPort, (uint8_t)*(const int32_t *)opt_val) != 0) {
+            /* Priority table is full */
+            stat = IOT_SOCKET_ENOMEM;
+          }
+        }
+
+        if (stat == 0) {
+          sock_flags_set (socket, SOCKET_FLAG_PRIORITY, (*(const int32_t *)opt_val != 0) ? 1U : 0U);
+        }
+      }
+    }
+  }
+  else if (opt_id == IOT_SOCKET_SO_TIMESTAMP) {
+    /* Timestamping of datagrams (default = 0) */
+    /* opt_val = &flags, opt_len = sizeof(flags), flags (integer): IOT_SOCKET_TIMESTAMP_xxx */
+    if ((NetifApi == NULL) || (NetifApi->SetTxTimestamp == NULL) || (NetifApi->GetRxTimestamp == NULL)) {
+      /* Network interface does not timestamp frames */
+      stat = IOT_SOCKET_ENOTSUP;
+    }
+    else if ((opt_len != sizeof(int32_t)) || ((*(const uint32_t *)opt_val & ~(IOT_SOCKET_TIMESTAMP_RX | IOT_SOCKET_TIMESTAMP_TX)) != 0U)) {
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else if (FreeRTOS_issocketconnected (xSocket) != -pdFREERTOS_ERRNO_EINVAL) {
+      /* Not a UDP socket */
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      ts   = *(const uint32_t *)opt_val;
+      stat = 0;
+
+      if (((ts & IOT_SOCKET_TIMESTAMP_TX) != 0U) || ((sock_attr[socket].flags & SOCKET_FLAG_TS_TX) != 0U)) {
+        /* Network interface timestamps frames by local port, socket must be bound */
+        (void)FreeRTOS_GetLocalAddress (xSocket, &xAddress);
+
+        if (xAddress.sin_port == 0U) {
+          stat = IOT_SOCKET_EINVAL;
+        }
+        else {
+          sock_attr[socket].usPort = FreeRTOS_ntohs (xAddress.sin_port);
+
+          /* Port timestamping is kept while other sockets of the port use it */
+          if (((ts & IOT_SOCKET_TIMESTAMP_TX) != 0U) ||
+              (sock_port_shared (socket, sock_attr[socket].usPort, SOCKET_FLAG_TS_TX) == 0U)) {
+            if (NetifApi->SetTxTimestamp (sock_attr[socket].usPort, ts & IOT_SOCKET_TIMESTAMP_TX) != 0) {
+              /* Timestamp table is full */
+              stat = IOT_SOCKET_ENOMEM;
+            }
+          }
+        }
+      }
+
+      if (stat == 0) {
+        /* Receive timestamp is returned by iotSocketRecvFromTs */
+        sock_flags_set (socket, SOCKET_FLAG_TS_RX, ts & IOT_SOCKET_TIMESTAMP_RX);
+        sock_flags_set (socket, SOCKET_FLAG_TS_TX, ts & IOT_SOCKET_TIMESTAMP_TX);
+      }
+    }
+  }
+  else if (opt_id == IOT_SOCKET_SO_BROADCAST) {
+    /* Send broadcast datagrams (default = 0) */
+    /* opt_val = &broadcast, opt_len = sizeof(broadcast), broadcast (integer): 0=disabled, enabled otherwise */
+    if (opt_len != sizeof(int32_t)) {
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else if (FreeRTOS_issocketconnected (xSocket) != -pdFREERTOS_ERRNO_EINVAL) {
+      /* Not a UDP socket */
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      /* Setting is checked by iotSocketSendTo */
+      sock_flags_set (socket, SOCKET_FLAG_BROADCAST, (*(const int32_t *)opt_val != 0) ? 1U : 0U);
+      stat = 0;
+    }
+  }
+  else if (opt_id == IOT_SOCKET_SO_LINGER) {
+    /* Linger on close in seconds (default = -1) */
+    /* opt_val = &linger, opt_len = sizeof(linger), linger (integer): -1=disabled, 0=abort connection, wait up to linger seconds otherwise */
+    if ((opt_len != sizeof(int32_t)) || (*(const int32_t *)opt_val < -1) || (*(const int32_t *)opt_val > 0xFFFF)) {
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else if (*(const int32_t *)opt_val == 0) {
+      /* FreeRTOS+TCP cannot abort a connection (send RST) on close */
+      stat = IOT_SOCKET_ENOTSUP;
+    }
+    else if (FreeRTOS_issocketconnected (xSocket) == -pdFREERTOS_ERRNO_EINVAL) {
+      /* Not a TCP socket */
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      /* Setting is applied by iotSocketClose */
+      sock_attr[socket].linger = *(const int32_t *)opt_val;
+      stat = 0;
+    }
+  }
+  else if (opt_id == IOT_SOCKET_SO_REUSEADDR) {
+    /* Reuse local address (default = 0) */
+    /* opt_val = &reuse, opt_len = sizeof(reuse), reuse (integer): 0=disabled, enabled otherwise */
+    /* Port of a closed socket is released immediately, connections in TIME_WAIT do not block bind */
+    /* Address reuse is always enabled, disabling it has no effect */
+    if (opt_len != sizeof(int32_t)) {
+      stat = IOT_SOCKET_EINVAL;
+    } else {
+      stat = 0;
+    }
+  }
+  else if (opt_id == IOT_SOCKET_TCP_NODELAY) {
+    /* Disable Nagle algorithm (default = 0) */
+    /* opt_val = &nodelay, opt_len = sizeof(nodelay), nodelay (integer): 0=Nagle enabled, disabled otherwise */
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else if (opt_id == IOT_SOCKET_TCP_CORK) {
+    /* Hold partial segments (default = 0) */
+    /* opt_val = &cork, opt_len = sizeof(cork), cork (integer): 0=send, hold partial segments until cleared otherwise */
+    if (opt_len != sizeof(int32_t)) {
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      xValue = (*(const int32_t *)opt_val != 0) ? pdTRUE : pdFALSE;
+
+      /* Send only full-size segments while set, clearing it sends the remaining data */
+      rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_SET_FULL_SIZE, &xValue, sizeof(xValue));
+
+      if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+        stat = IOT_SOCKET_EINVAL;
+      } else {
+        stat = 0U;
+      }
+    }
+  }
+  else if ((opt_id == IOT_SOCKET_SO_RCVBUF) || (opt_id == IOT_SOCKET_SO_SNDBUF)) {
+    /* Receive/send buffer size in bytes */
+    /* opt_val = &size, opt_len = sizeof(size) */
+    if (opt_len != sizeof(uint32_t)) {
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      /* Buffer size can only be set before the stream buffers are created */
+      if (opt_id == IOT_SOCKET_SO_RCVBUF) {
+        rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_RCVBUF, opt_val, sizeof(uint32_t));
+      } else {
+        rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_SNDBUF, opt_val, sizeof(uint32_t));
+      }
+
+      if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+        stat = IOT_SOCKET_EINVAL;
+      } else {
+        stat = 0U;
+      }
+    }
+  }
+  else if (opt_id == IOT_SOCKET_TCP_WINDOW) {
+    /* TCP window size hint in bytes */
+    /* opt_val = &size, opt_len = sizeof(size) */
+#if (ipconfigUSE_TCP_WIN == 1)
+    if (opt_len != sizeof(uint32_t)) {
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      memcpy (&ulSize, opt_val, sizeof(ulSize));
+
+      /* Window is set in units of MSS, buffers must hold the complete window */
+      xWinProperties.lRxWinSize = (int32_t)((ulSize + ipconfigTCP_MSS - 1U) / ipconfigTCP_MSS);
+      if (xWinProperties.lRxWinSize == 0) {
+        xWinProperties.lRxWinSize = 1;
+      }
+      xWinProperties.lTxWinSize = xWinProperties.lRxWinSize;
+      xWinProperties.lRxBufSize = xWinProperties.lRxWinSize * ipconfigTCP_MSS;
+      xWinProperties.lTxBufSize = xWinProperties.lTxWinSize * ipconfigTCP_MSS;
+
+      rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_WIN_PROPERTIES, &xWinProperties, sizeof(xWinProperties));
+
+      if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+        stat = IOT_SOCKET_EINVAL;
+      } else {
+        stat = 0U;
+      }
+    }
+#else
+    /* Sliding window is disabled (ipconfigUSE_TCP_WIN = 0) */
+    stat = IOT_SOCKET_ENOTSUP;
+#endif
+  }
+  else if ((opt_id == IOT_SOCKET_IP_ADD_MEMBERSHIP) || (opt_id == IOT_SOCKET_IP_DROP_MEMBERSHIP)) {
+    /* Join/leave IPv4 multicast group */
+    /* opt_val = &mreq, opt_len = sizeof(mreq), mreq: iotSocketMreq_t */
+#ifdef FREERTOS_SO_IP_ADD_MEMBERSHIP
+    if (opt_len != sizeof(iotSocketMreq_t)) {
+      stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      memcpy (&xMReq.imr_multiaddr.s_addr, ((const iotSocketMreq_t *)opt_val)->group,  4U);
+      memcpy (&xMReq.imr_interface.s_addr, ((const iotSocketMreq_t *)opt_val)->ifaddr, 4U);
+
+      if (opt_id == IOT_SOCKET_IP_ADD_MEMBERSHIP) {
+        rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_IP_ADD_MEMBERSHIP, &xMReq, sizeof(xMReq));
+      } else {
+        rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_IP_DROP_MEMBERSHIP, &xMReq, sizeof(xMReq));
+      }
+
+      if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+        stat = IOT_SOCKET_EINVAL;
+      } else {
+        stat = 0U;
+        /* Pass subscribed groups through the Ethernet MAC address filter of the network interface */
+        if ((NetifApi != NULL) && (NetifApi->AddMulticastMAC != NULL) && (NetifApi->RemoveMulticastMAC != NULL)) {
+          /* Map group address to multicast MAC address 01:00:5E + lower 23 bits */
+          ucMAC[0] = 0x01U;
+          ucMAC[1] = 0x00U;
+          ucMAC[2] = 0x5EU;
+          ucMAC[3] = ((const iotSocketMreq_t *)opt_val)->group[1] & 0x7FU;
+          ucMAC[4] = ((const iotSocketMreq_t *)opt_val)->group[2];
+          ucMAC[5] = ((const iotSocketMreq_t *)opt_val)->group[3];
+
+          if (opt_id == IOT_SOCKET_IP_ADD_MEMBERSHIP) {
+            if (NetifApi->AddMulticastMAC (ucMAC) != 0) {
+              /* Group frames would not be received, leave the group again */
+              (void)FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_IP_DROP_MEMBERSHIP, &xMReq, sizeof(xMReq));
+              stat = IOT_SOCKET_ERROR;
+            }
+          }
+          else if (NetifApi->RemoveMulticastMAC (ucMAC) != 0) {
+            stat = IOT_SOCKET_ERROR;
+          }
+        }
+      }
+    }
+#else
+    /* Multicast is not supported by this FreeRTOS+TCP version */
+    stat = IOT_SOCKET_ENOTSUP;
+#endif
+  }
+  else if (opt_id == IOT_SOCKET_IP_MULTICAST_TTL) {
+    /* IPv4 multicast time-to-live (default = 1) */
+    /* opt_val = &ttl, opt_len = sizeof(ttl) */
+#ifdef FREERTOS_SO_IP_MULTICAST_TTL
+    if ((opt_len != sizeof(int32_t)) || (*(const int32_t *)opt_val < 0) || (*(const int32_t *)opt_val > 255)) {
       stat = IOT_SOCKET_EINVAL;
+    }
+    else {
+      ucTTL = (uint8_t)*(const int32_t *)opt_val;
+      rval = FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_IP_MULTICAST_TTL, &ucTTL, sizeof(ucTTL));
+
+      if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+        stat = IOT_SOCKET_EINVAL;
+      } else {
+        stat = 0U;
+      }
+    }
+#else
+    stat = IOT_SOCKET_ENOTSUP;
+#endif
+  }
+  else if ((opt_id == IOT_SOCKET_IP_MULTICAST_LOOP) ||
+           (opt_id == IOT_SOCKET_IPV6_JOIN_GROUP)   || (opt_id == IOT_SOCKET_IPV6_LEAVE_GROUP) ||
+           (opt_id == IOT_SOCKET_IPV6_MULTICAST_HOPS) || (opt_id == IOT_SOCKET_IPV6_MULTICAST_LOOP)) {
+    /* Multicast loopback is not provided, only IPv4 sockets are supported */
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else {
+    stat = IOT_SOCKET_EINVAL;
+  }
+
+  return stat;
+}
+
+// Shut down part or all of a full-duplex connection
+int32_t iotSocketShutdown (int32_t socket, int32_t how) {
+  Socket_t xSocket = sock_get (socket);
+  BaseType_t rval;
+  int32_t stat;
+
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  if ((how != IOT_SOCKET_SHUT_RD) && (how != IOT_SOCKET_SHUT_WR) && (how != IOT_SOCKET_SHUT_RDWR)) {
+    stat = IOT_SOCKET_EINVAL;
+  }
+  else if (how != IOT_SOCKET_SHUT_RDWR) {
+    /* FreeRTOS+TCP shuts down both directions, send or receive side cannot be shut down separately */
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else {
+    /* Send FIN and shut down both directions */
+    rval = FreeRTOS_shutdown (xSocket, FREERTOS_SHUT_RDWR);
+
+    if (rval == 0) {
+      stat = 0;
+    }
+    else if (rval == -pdFREERTOS_ERRNO_EINVAL) {
+      /* Invalid socket */
+      stat = IOT_SOCKET_ESOCK;
+    }
+    else {
+      /* Not a TCP socket or not connected */
+      stat = IOT_SOCKET_ENOTCONN;
+    }
   }
 
   return stat;
@@ -589,11 +1669,40 @@ int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, ui
 
 // Close and release a socket
 int32_t iotSocketClose (int32_t socket) {
-  Socket_t xSocket =(Socket_t)socket;
+  Socket_t xSocket = sock_get (socket);
+  uint32_t flags;
+  uint16_t usPort;
+  TimeOut_t xTimeOut;
   BaseType_t rval;
   TickType_t xTimeout;
+  int32_t linger;
+  uint8_t ucBuf[32];
   int32_t stat;
 
+  if (xSocket == NULL) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  flags  = sock_attr[socket].flags;
+  usPort = sock_attr[socket].usPort;
+
+  linger = sock_attr[socket].linger;
+  if ((linger > 0) && (FreeRTOS_issocketconnected (xSocket) == pdTRUE)) {
+    /* Lingering close: send FIN and wait until the peer closes the connection */
+    if (FreeRTOS_shutdown (xSocket, FREERTOS_SHUT_RDWR) == 0) {
+      xTimeout = pdMS_TO_TICKS ((uint32_t)linger * 1000U);
+      vTaskSetTimeOutState (&xTimeOut);
+
+      do {
+        /* Receive blocks until data arrives, the peer closes the connection or the linger time expires */
+        (void)FreeRTOS_setsockopt (xSocket, 0U, FREERTOS_SO_RCVTIMEO, &xTimeout, sizeof(xTimeout));
+
+        /* Discard data still arriving from the peer */
+        rval = FreeRTOS_recv (xSocket, ucBuf, sizeof(ucBuf), 0);
+      } while ((rval > 0) && (xTaskCheckForTimeOut (&xTimeOut, &xTimeout) == pdFALSE));
+    }
+  }
+
   rval = FreeRTOS_closesocket(xSocket);
   
   if (rval == 0) {
@@ -606,6 +1715,24 @@ int32_t iotSocketClose (int32_t socket) {
   }
   else {
     stat = 0U;
+
+    /* Release socket id */
+    sock_attr[socket].xSocket = NULL;
+
+    /* Port settings are released with the last socket of the port using them */
+    if (NetifApi == NULL) {
+      flags = 0U;
+    }
+    if (((flags & SOCKET_FLAG_PRIORITY) != 0U) &&
+        (sock_port_shared (socket, usPort, SOCKET_FLAG_PRIORITY) == 0U)) {
+      /* Release transmit priority of the local port */
+      (void)NetifApi->SetTxPriority (usPort, 0U);
+    }
+    if (((flags & SOCKET_FLAG_TS_TX) != 0U) &&
+        (sock_port_shared (socket, usPort, SOCKET_FLAG_TS_TX) == 0U)) {
+      /* Release transmit timestamp of the local port */
+      (void)NetifApi->SetTxTimestamp (usPort, 0U);
+    }
   }
 
   return stat;
@@ -635,6 +1762,7 @@ int32_t iotSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint3
 
       /* Copy retrieved IP address into provided buffer */
       memcpy (ip, &addr, sizeof(addr));
+      *ip_len = sizeof(addr);
     } else {
       stat = IOT_SOCKET_EHOSTNOTFOUND;
     }
@@ -642,3 +1770,80 @@ int32_t iotSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint3
 
   return stat;
 }
+
+// Retrieve all host IP addresses from host name
+int32_t iotSocketGetAddrInfo (const char *name, int32_t af, iotSocketAddr_t *addrs, uint32_t *count, uint32_t *ttls) {
+  struct freertos_addrinfo xHints;
+  struct freertos_addrinfo *pxResult;
+  struct freertos_addrinfo *pxInfo;
+  BaseType_t rval;
+  uint32_t num;
+  int32_t stat;
+
+  if ((name == NULL) || (addrs == NULL) || (count == NULL) || (*count == 0U)) {
+    stat = IOT_SOCKET_EINVAL;
+  }
+  else if ((af != IOT_SOCKET_AF_UNSPEC) && (af != IOT_SOCKET_AF_INET)) {
+    /* Only IPv4 is supported */
+    stat = IOT_SOCKET_ENOTSUP;
+  }
+  else {
+    memset (&xHints, 0, sizeof(xHints));
+    xHints.ai_family = FREERTOS_AF_INET;
+
+    pxResult = NULL;
+    rval = FreeRTOS_getaddrinfo (name, NULL, &xHints, &pxResult);
+
+    num = 0U;
+
+    if (rval == 0) {
+      /* Copy all retrieved IP addresses (up to ipconfigDNS_CACHE_ADDRESSES_PER_ENTRY) */
+      for (pxInfo = pxResult; (pxInfo != NULL) && (num < *count); pxInfo = pxInfo->ai_next) {
+        if (pxInfo->ai_family == FREERTOS_AF_INET) {
+          memcpy (addrs[num].ip, &pxInfo->ai_addr->sin_addr, 4U);
+          addrs[num].ip_len = 4U;
+
+          if (ttls != NULL) {
+            /* Record TTL is not reported by the resolver */
+            ttls[num] = 0U;
+          }
+          num++;
+        }
+      }
+      FreeRTOS_freeaddrinfo (pxResult);
+    }
+
+    if (num != 0U) {
+      *count = num;
+      stat = 0U;
+    }
+    else if (rval == -pdFREERTOS_ERRNO_ENOMEM) {
+      stat = IOT_SOCKET_ENOMEM;
+    }
+    else {
+      stat = IOT_SOCKET_EHOSTNOTFOUND;
+    }
+  }
+
+  return stat;
+}
+
+// Retrieve directed broadcast address of the local network
+int32_t iotSocketGetBroadcastAddr (uint8_t *ip, uint32_t *ip_len) {
+  uint32_t ulBroadcast;
+  int32_t stat;
+
+  if ((ip == NULL) || (ip_len == NULL) || (*ip_len < 4U)) {
+    stat = IOT_SOCKET_EINVAL;
+  }
+  else {
+    stat = get_broadcast (&ulBroadcast);
+
+    if (stat == 0) {
+      memcpy (ip, &ulBroadcast, 4U);
+      *ip_len = 4U;
+    }
+  }
+
+  return stat;
+}
@@ -0,0 +1,283 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (c) 2026 Arm Limited (or its affiliates). All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * -------------------------------------------------------------------------- */
+
+#include <stddef.h>
+#include "iot_socket.h"
+#include "iot_socket_happy_eyeballs.h"
+#include "cmsis_os2.h"
+
+// Delay in ms before the next connection attempt is started (RFC 8305: Connection Attempt Delay)
+#ifndef IOT_SOCKET_HE_ATTEMPT_DELAY
+#define IOT_SOCKET_HE_ATTEMPT_DELAY     250
+#endif
+
+// Maximum number of concurrent connection attempts
+#ifndef IOT_SOCKET_HE_MAX_ATTEMPTS
+#define IOT_SOCKET_HE_MAX_ATTEMPTS      4
+#endif
+
+// Maximum number of addresses considered
+#ifndef IOT_SOCKET_HE_MAX_ADDRS
+#define IOT_SOCKET_HE_MAX_ADDRS         8
+#endif
+
+// Interval in ms for polling pending connection attempts
+#ifndef IOT_SOCKET_HE_POLL_INTERVAL
+#define IOT_SOCKET_HE_POLL_INTERVAL     10
+#endif
+
+// Connection attempt
+typedef struct {
+  int32_t  sock;                // Socket (-1 = slot not used)
+  uint32_t idx;                 // Index of the address in use
+} he_attempt_t;
+
+// Convert milliseconds to kernel ticks (at least one tick)
+static uint32_t he_ticks (uint32_t ms) {
+  uint32_t ticks;
+
+  ticks = (uint32_t)(((uint64_t)ms * osKernelGetTickFreq()) / 1000U);
+  if (ticks == 0U) {
+    ticks = 1U;
+  }
+  return ticks;
+}
+
+// Find next address with specified length, starting at index 'from'
+static uint32_t he_next (const iotSocketAddr_t *addrs, uint32_t count, uint32_t from, uint32_t ip_len) {
+
+  while ((from < count) && (addrs[from].ip_len != ip_len)) {
+    from++;
+  }
+  return from;
+}
+
+// Order addresses by interleaving address families,
+// starting with the family of the first address (RFC 8305, section 4)
+static void he_order (const iotSocketAddr_t *addrs, uint32_t count, uint8_t *order) {
+  uint32_t len[2], pos[2];
+  uint32_t n, f;
+
+  len[0] = addrs[0].ip_len;
+  len[1] = (len[0] == 4U) ? 16U : 4U;
+  pos[0] = 0U;
+  pos[1] = he_next(addrs, count, 0U, len[1]);
+
+  f = 0U;
+  for (n = 0U; n < count; ) {
+    if (pos[f] < count) {
+      order[n++] = (uint8_t)pos[f];
+      pos[f] = he_next(addrs, count, pos[f] + 1U, len[f]);
+    }
+    f ^= 1U;
+  }
+}
+
+// Close socket, repeat while close is in progress
+static void he_close (int32_t sock) {
+
+  while (iotSocketClose(sock) == IOT_SOCKET_EAGAIN) {
+    osDelay(1U);
+  }
+}
+
+// Check result of iotSocketConnect on a non-blocking socket
+static int32_t he_pending (int32_t rc) {
+
+  if ((rc == IOT_SOCKET_EINPROGRESS) || (rc == IOT_SOCKET_EALREADY) || (rc == IOT_SOCKET_EAGAIN)) {
+    return 1;
+  }
+  return 0;
+}
+
+// Create non-blocking socket and start connecting
+static int32_t he_start (const iotSocketAddr_t *addr, uint16_t port, int32_t *sock) {
+  unsigned long nbio = 1U;
+  int32_t  af;
+  int32_t  rc;
+
+  af = (addr->ip_len == 4U) ? IOT_SOCKET_AF_INET : IOT_SOCKET_AF_INET6;
+  rc = iotSocketCreate(af, IOT_SOCKET_SOCK_STREAM, IOT_SOCKET_IPPROTO_TCP);
+  if (rc < 0) {
+    return rc;
+  }
+  *sock = rc;
+
+  rc = iotSocketSetOpt(*sock, IOT_SOCKET_IO_FIONBIO, &nbio, sizeof(nbio));
+  if (rc == 0) {
+    rc = iotSocketConnect(*sock, addr->ip, addr->ip_len, port);
+  }
+  if ((rc == 0) || (rc == IOT_SOCKET_EISCONN)) {
+    return 0;
+  }
+  if (he_pending(rc)) {
+    return IOT_SOCKET_EINPROGRESS;
+  }
+
+  he_close(*sock);
+  *sock = -1;
+  return rc;
+}
+
+// Connect a stream socket to one of the remote host addresses
+int32_t iotSocketHappyEyeballsConnectAddr (const iotSocketAddr_t *addrs, uint32_t count, uint16_t port, uint32_t timeout) {
+  he_attempt_t att[IOT_SOCKET_HE_MAX_ATTEMPTS];
+  uint8_t  order[IOT_SOCKET_HE_MAX_ADDRS];
+  uint32_t next, active, i;
+  uint32_t start, last, now;
+  uint32_t delay, tout, poll;
+  unsigned long nbio;
+  int32_t  sock;
+  int32_t  err;
+  int32_t  rc;
+
+  // Check parameters
+  if ((addrs == NULL) || (count == 0U) || (port == 0U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if (count > IOT_SOCKET_HE_MAX_ADDRS) {
+    count = IOT_SOCKET_HE_MAX_ADDRS;
+  }
+  for (i = 0U; i < count; i++) {
+    if ((addrs[i].ip_len != 4U) && (addrs[i].ip_len != 16U)) {
+      return IOT_SOCKET_EINVAL;
+    }
+  }
+
+  he_order(addrs, count, order);
+  for (i = 0U; i < IOT_SOCKET_HE_MAX_ATTEMPTS; i++) {
+    att[i].sock = -1;
+  }
+
+  delay  = he_ticks(IOT_SOCKET_HE_ATTEMPT_DELAY);
+  poll   = he_ticks(IOT_SOCKET_HE_POLL_INTERVAL);
+  tout   = he_ticks(timeout);
+  next   = 0U;
+  active = 0U;
+  sock   = -1;
+  err    = IOT_SOCKET_ETIMEDOUT;
+  start  = osKernelGetTickCount();
+  last   = start;
+
+  for (;;) {
+    now = osKernelGetTickCount();
+
+    // Start next attempt when no attempt is pending or the attempt delay has elapsed
+    if ((next < count) && (active < IOT_SOCKET_HE_MAX_ATTEMPTS) &&
+        ((active == 0U) || ((now - last) >= delay))) {
+      for (i = 0U; att[i].sock >= 0; i++);
+      att[i].idx = order[next++];
+      last = now;
+      rc = he_start(&addrs[att[i].idx], port, &att[i].sock);
+      if (rc == 0) {
+        sock = att[i].sock;
+        att[i].sock = -1;
+        break;
+      }
+      if (rc == IOT_SOCKET_EINPROGRESS) {
+        active++;
+      } else {
+        // Attempt failed immediately, continue with the next address
+        err = rc;
+        continue;
+      }
+    }
+
+    // Check pending attempts
+    for (i = 0U; i < IOT_SOCKET_HE_MAX_ATTEMPTS; i++) {
+      if (att[i].sock < 0) {
+        continue;
+      }
+      rc = iotSocketConnect(att[i].sock, addrs[att[i].idx].ip, addrs[att[i].idx].ip_len, port);
+      if ((rc == 0) || (rc == IOT_SOCKET_EISCONN)) {
+        sock = att[i].sock;
+        att[i].sock = -1;
+        break;
+      }
+      if (!he_pending(rc)) {
+        he_close(att[i].sock);
+        att[i].sock = -1;
+        active--;
+        err = rc;
+      }
+    }
+    if (sock >= 0) {
+      break;
+    }
+    if ((active == 0U) && (next == count)) {
+      // All attempts failed
+      break;
+    }
+    if ((timeout != 0U) && ((osKernelGetTickCount() - start) >= tout)) {
+      err = IOT_SOCKET_ETIMEDOUT;
+      break;
+    }
+    osDelay(poll);
+  }
+
+  // Close attempts that lost the race
+  for (i = 0U; i < IOT_SOCKET_HE_MAX_ATTEMPTS; i++) {
+    if (att[i].sock >= 0) {
+      he_close(att[i].sock);
+    }
+  }
+  if (sock < 0) {
+    return err;
+  }
+
+  // Return socket in blocking mode
+  nbio = 0U;
+  iotSocketSetOpt(sock, IOT_SOCKET_IO_FIONBIO, &nbio, sizeof(nbio));
+
+  return sock;
+}
+
+// Resolve host name and connect a stream socket to one of its addresses
+int32_t iotSocketHappyEyeballsConnect (const char *name, uint16_t port, uint32_t timeout) {
+  iotSocketAddr_t addrs[IOT_SOCKET_HE_MAX_ADDRS];
+  uint32_t count;
+  int32_t  rc;
+
+  if (name == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  count = IOT_SOCKET_HE_MAX_ADDRS;
+  rc = iotSocketGetAddrInfo(name, IOT_SOCKET_AF_UNSPEC, addrs, &count, NULL);
+  if (rc == IOT_SOCKET_ENOTSUP) {
+    // Fall back to one address per address family
+    count = 0U;
+    addrs[count].ip_len = sizeof(addrs[count].ip);
+    if (iotSocketGetHostByName(name, IOT_SOCKET_AF_INET6, addrs[count].ip, &addrs[count].ip_len) == 0) {
+      count++;
+    }
+    addrs[count].ip_len = sizeof(addrs[count].ip);
+    rc = iotSocketGetHostByName(name, IOT_SOCKET_AF_INET, addrs[count].ip, &addrs[count].ip_len);
+    if (rc == 0) {
+      count++;
+    }
+    if (count != 0U) {
+      rc = 0;
+    }
+  }
+  if (rc != 0) {
+    return rc;
+  }
+
+  return iotSocketHappyEyeballsConnectAddr(addrs, count, port, timeout);
+}
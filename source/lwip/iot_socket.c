@@ -20,6 +20,9 @@
 #include "iot_socket.h"
 #include "lwip/netdb.h"
 #include "lwip/sockets.h"
+#include "lwip/netif.h"
+#include "lwip/tcpip.h"
+#include "lwip/sys.h"
 #include "RTE_Components.h"
 
 #define NUM_SOCKS   MEMP_NUM_NETCONN
@@ -46,6 +49,7 @@ static int32_t errno_to_rc (void) {
       break;
     case EIO:
     case EINVAL:
+    case EACCES:
       rc = IOT_SOCKET_EINVAL;
       break;
     case ENOMEM:
@@ -78,6 +82,9 @@ static int32_t errno_to_rc (void) {
     case EHOSTUNREACH:
       rc = IOT_SOCKET_EHOSTNOTFOUND;
       break;
+    case EOPNOTSUPP:
+      rc = IOT_SOCKET_ENOTSUP;
+      break;
     default:
       rc = IOT_SOCKET_ERROR;
       break;
@@ -147,7 +154,7 @@ int32_t iotSocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint1
   int32_t rc;
 
   // Check parameters
-  if ((ip == NULL) || (port == 0)) {
+  if (ip == NULL) {
     return IOT_SOCKET_EINVAL;
   }
 
@@ -286,8 +293,8 @@ int32_t iotSocketConnect (int32_t socket, const uint8_t *ip, uint32_t ip_len, ui
   return rc;
 }
 
-// Check if socket is readable
-static int32_t socket_check_read (int32_t socket) {
+// Check if socket is readable (without waiting when dontwait is set)
+static int32_t socket_check_read (int32_t socket, uint32_t dontwait) {
   struct timeval tv, *ptv;
   fd_set  fds;
   int32_t nr;
@@ -300,7 +307,7 @@ static int32_t socket_check_read (int32_t socket) {
   FD_SET(socket, &fds);
   ptv = &tv;
   memset (&tv, 0, sizeof(tv));
-  if (!sock_attr[socket-LWIP_SOCKET_OFFSET].ionbio) {
+  if (!sock_attr[socket-LWIP_SOCKET_OFFSET].ionbio && !dontwait) {
     tv.tv_sec  = sock_attr[socket-LWIP_SOCKET_OFFSET].tv_sec;
     tv.tv_usec = sock_attr[socket-LWIP_SOCKET_OFFSET].tv_msec * 1000;
     if ((tv.tv_sec == 0U) && (tv.tv_usec == 0U)) {
@@ -319,7 +326,7 @@ int32_t iotSocketRecv (int32_t socket, void *buf, uint32_t len) {
   int32_t rc;
 
   if (len == 0U) {
-    return socket_check_read (socket);
+    return socket_check_read (socket, 0U);
   }
   if (buf == NULL) {
     return IOT_SOCKET_EINVAL;
@@ -339,7 +346,7 @@ int32_t iotSocketRecvFrom (int32_t socket, void *buf, uint32_t len, uint8_t *ip,
   int32_t rc;
 
   if (len == 0U) {
-    return socket_check_read (socket);
+    return socket_check_read (socket, 0U);
   }
   if (buf == NULL) {
     return IOT_SOCKET_EINVAL;
@@ -424,6 +431,42 @@ int32_t iotSocketSend (int32_t socket, const void *buf, uint32_t len) {
   return rc;
 }
 
+// Get directed broadcast address of the default network interface
+static int32_t get_broadcast (uint8_t *ip) {
+  uint32_t addr;
+  int32_t  rc;
+
+  LOCK_TCPIP_CORE();
+  if ((netif_default != NULL) && !ip4_addr_isany(netif_ip4_addr(netif_default))) {
+    addr = ip4_addr_get_u32(netif_ip4_addr(netif_default)) | ~ip4_addr_get_u32(netif_ip4_netmask(netif_default));
+    memcpy(ip, &addr, sizeof(addr));
+    rc = 0;
+  } else {
+    rc = IOT_SOCKET_ENOTCONN;
+  }
+  UNLOCK_TCPIP_CORE();
+
+  return rc;
+}
+
+#if !IP_SOF_BROADCAST
+// Check if sending to IPv4 address is permitted (SO_BROADCAST for broadcast addresses)
+static int32_t check_broadcast (int32_t socket, const uint8_t *ip) {
+  uint8_t  bcast[4];
+  int      val;
+  uint32_t val_len = sizeof(val);
+
+  if ((memcmp(ip, "\xFF\xFF\xFF\xFF", 4) != 0) &&
+      ((get_broadcast(bcast) != 0) || (memcmp(ip, bcast, 4) != 0))) {
+    return 0;
+  }
+  if ((getsockopt(socket, SOL_SOCKET, SO_BROADCAST, (char *)&val, &val_len) == 0) && (val != 0)) {
+    return 0;
+  }
+  return IOT_SOCKET_EINVAL;
+}
+#endif
+
 // Send data on a socket
 int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
   struct sockaddr_storage addr;
@@ -441,6 +484,13 @@ int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const ui
     switch (ip_len) {
       case sizeof(struct in_addr): {
         struct sockaddr_in *sa = (struct sockaddr_in *)&addr;
+#if !IP_SOF_BROADCAST
+        // lwIP does not check SO_BROADCAST
+        rc = check_broadcast(socket, ip);
+        if (rc < 0) {
+          return rc;
+        }
+#endif
         sa->sin_len    = sizeof(struct sockaddr_in);
         sa->sin_family = AF_INET;
         sa->sin_port   = lwip_htons((port));
@@ -471,6 +521,280 @@ int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const ui
   return rc;
 }
 
+// Receive data on a connected socket with message flags
+int32_t iotSocketRecvEx (int32_t socket, void *buf, uint32_t len, uint32_t flags) {
+  int      type     = SOCK_STREAM;
+  uint32_t type_len = sizeof(type);
+  int      msg_flags;
+  uint32_t num;
+  int32_t  rc;
+
+  if ((flags & ~(IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_DONTWAIT | IOT_SOCKET_MSG_WAITALL | IOT_SOCKET_MSG_TRUNC)) != 0U) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((flags & (IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_WAITALL)) == (IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_WAITALL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if (len == 0U) {
+    return socket_check_read (socket, flags & IOT_SOCKET_MSG_DONTWAIT);
+  }
+  if (buf == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  msg_flags = 0;
+  if ((flags & IOT_SOCKET_MSG_PEEK) != 0U) {
+    msg_flags |= MSG_PEEK;
+  }
+  if ((flags & IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+    msg_flags |= MSG_DONTWAIT;
+  }
+  if ((flags & (IOT_SOCKET_MSG_WAITALL | IOT_SOCKET_MSG_TRUNC)) != 0U) {
+    if (getsockopt(socket, SOL_SOCKET, SO_TYPE, (char *)&type, &type_len) < 0) {
+      return errno_to_rc ();
+    }
+  }
+
+  if ((type == SOCK_DGRAM) && ((flags & IOT_SOCKET_MSG_TRUNC) != 0U)) {
+#if LWIP_FIONREAD_LINUXMODE
+    int size;
+
+    // Wait for a datagram and read the length of it
+    rc = recv(socket, buf, len, msg_flags | MSG_PEEK);
+    if ((rc < 0) || (ioctlsocket(socket, FIONREAD, &size) < 0)) {
+      return errno_to_rc ();
+    }
+    if ((flags & IOT_SOCKET_MSG_PEEK) == 0U) {
+      rc = recv(socket, buf, len, MSG_DONTWAIT);
+      if (rc < 0) {
+        return errno_to_rc ();
+      }
+    }
+    return (size > rc) ? size : rc;
+#else
+    // Length of pending datagram requires LWIP_FIONREAD_LINUXMODE
+    return IOT_SOCKET_ENOTSUP;
+#endif
+  }
+
+  num = 0U;
+  do {
+    rc = recv(socket, (uint8_t *)buf + num, len - num, msg_flags);
+    if (rc <= 0) {
+      break;
+    }
+    num += (uint32_t)rc;
+  } while ((type == SOCK_STREAM) && ((flags & IOT_SOCKET_MSG_WAITALL) != 0U) && (num < len));
+
+  if (num != 0U) {
+    // Return received data, error is reported on the next call
+    return (int32_t)num;
+  }
+  if (rc < 0) {
+    return errno_to_rc ();
+  }
+
+  return rc;
+}
+
+// Send data on a connected socket with message flags
+int32_t iotSocketSendEx (int32_t socket, const void *buf, uint32_t len, uint32_t flags) {
+  int32_t rc;
+
+  if ((flags & ~IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if (len == 0U) {
+    return socket_check_write (socket);
+  }
+  if (buf == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+  rc = send(socket, buf, len, (flags & IOT_SOCKET_MSG_DONTWAIT) ? MSG_DONTWAIT : 0);
+  if (rc < 0) {
+    rc = errno_to_rc ();
+    if (rc == IOT_SOCKET_EINPROGRESS &&
+        (sock_attr[socket-LWIP_SOCKET_OFFSET].ionbio || (flags & IOT_SOCKET_MSG_DONTWAIT))) {
+      return IOT_SOCKET_EAGAIN;
+    }
+  }
+
+  return rc;
+}
+
+// Update time budget with the time elapsed since start
+static void timeout_update (u32_t start, uint32_t *timeout) {
+  u32_t elapsed;
+
+  elapsed = sys_now() - start;
+  *timeout = (elapsed < *timeout) ? (*timeout - elapsed) : 0U;
+}
+
+// Wait until socket is readable (or writable) within the time budget
+static int32_t socket_wait (int32_t socket, uint32_t write, uint32_t *timeout) {
+  struct timeval tv;
+  fd_set  fds;
+  u32_t   start;
+  int32_t nr;
+
+  if ((socket < LWIP_SOCKET_OFFSET) || (socket >= (LWIP_SOCKET_OFFSET + NUM_SOCKS))) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  FD_ZERO(&fds);
+  FD_SET(socket, &fds);
+  tv.tv_sec  = (long)(*timeout / 1000U);
+  tv.tv_usec = (long)(*timeout % 1000U) * 1000;
+  start = sys_now();
+  if (write) {
+    nr = select (socket+1, NULL, &fds, NULL, &tv);
+  } else {
+    nr = select (socket+1, &fds, NULL, NULL, &tv);
+  }
+  timeout_update (start, timeout);
+  if (nr < 0) {
+    return errno_to_rc ();
+  }
+  if (nr == 0) {
+    *timeout = 0U;
+    return IOT_SOCKET_ETIMEDOUT;
+  }
+  return 0;
+}
+
+// Accept a new connection on a socket within a time budget
+int32_t iotSocketAcceptTimed (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port, uint32_t *timeout) {
+  int32_t rc;
+
+  if (timeout == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Listening socket is readable when a connection request is pending
+  rc = socket_wait (socket, 0U, timeout);
+  if (rc < 0) {
+    return rc;
+  }
+  return iotSocketAccept (socket, ip, ip_len, port);
+}
+
+// Connect a socket to a remote host within a time budget
+int32_t iotSocketConnectTimed (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port, uint32_t *timeout) {
+  unsigned long nbio;
+  int32_t rc;
+
+  if (timeout == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((socket < LWIP_SOCKET_OFFSET) || (socket >= (LWIP_SOCKET_OFFSET + NUM_SOCKS))) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  // Non-blocking mode is a netconn flag, setting it does not involve tcpip_thread
+  if (!sock_attr[socket-LWIP_SOCKET_OFFSET].ionbio) {
+    nbio = 1U;
+    ioctlsocket(socket, FIONBIO, &nbio);
+  }
+
+  rc = iotSocketConnect (socket, ip, ip_len, port);
+  if ((rc == IOT_SOCKET_EINPROGRESS) || (rc == IOT_SOCKET_EALREADY)) {
+    // Socket becomes writable when the connection is established or failed
+    rc = socket_wait (socket, 1U, timeout);
+    if (rc == 0) {
+      rc = iotSocketConnect (socket, ip, ip_len, port);
+    }
+  }
+
+  if (rc == IOT_SOCKET_EISCONN) {
+    sock_attr[socket-LWIP_SOCKET_OFFSET].bound = 1;
+    rc = 0;
+  }
+
+  if (!sock_attr[socket-LWIP_SOCKET_OFFSET].ionbio) {
+    nbio = 0U;
+    ioctlsocket(socket, FIONBIO, &nbio);
+  }
+
+  return rc;
+}
+
+// Receive data on a connected socket within a time budget
+int32_t iotSocketRecvTimed (int32_t socket, void *buf, uint32_t len, uint32_t *timeout) {
+  int32_t rc;
+
+  if ((buf == NULL) || (len == 0U) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  for (;;) {
+    rc = socket_wait (socket, 0U, timeout);
+    if (rc < 0) {
+      break;
+    }
+    rc = recv(socket, buf, len, MSG_DONTWAIT);
+    if (rc >= 0) {
+      break;
+    }
+    rc = errno_to_rc ();
+    if (rc != IOT_SOCKET_EAGAIN) {
+      break;
+    }
+    if (*timeout == 0U) {
+      // Data was consumed by another thread
+      rc = IOT_SOCKET_ETIMEDOUT;
+      break;
+    }
+  }
+
+  return rc;
+}
+
+// Send data on a connected socket within a time budget
+int32_t iotSocketSendTimed (int32_t socket, const void *buf, uint32_t len, uint32_t *timeout) {
+  int32_t rc;
+
+  if ((buf == NULL) || (len == 0U) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  for (;;) {
+    rc = send(socket, buf, len, MSG_DONTWAIT);
+    if (rc >= 0) {
+      break;
+    }
+    rc = errno_to_rc ();
+    if ((rc != IOT_SOCKET_EAGAIN) && (rc != IOT_SOCKET_EINPROGRESS)) {
+      break;
+    }
+    if (*timeout == 0U) {
+      // Time budget expired
+      rc = IOT_SOCKET_ETIMEDOUT;
+      break;
+    }
+    // Socket becomes writable when there is space in the send buffer
+    rc = socket_wait (socket, 1U, timeout);
+    if (rc < 0) {
+      break;
+    }
+  }
+
+  return rc;
+}
+
+// Receive data on a socket together with its receive timestamp
+int32_t iotSocketRecvFromTs (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port, iotSocketTimestamp_t *ts) {
+  (void)socket;
+  (void)buf;
+  (void)len;
+  (void)ip;
+  (void)ip_len;
+  (void)port;
+  (void)ts;
+
+  // lwIP does not keep the receive time of a datagram
+  return IOT_SOCKET_ENOTSUP;
+}
+
 // Retrieve local IP address and port of a socket
 int32_t iotSocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
   struct sockaddr_storage addr;
@@ -572,6 +896,21 @@ int32_t iotSocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, uint32_t
   switch (opt_id) {
     case IOT_SOCKET_IO_FIONBIO:
       return IOT_SOCKET_EINVAL;
+    case IOT_SOCKET_IO_FIONREAD:
+#if LWIP_SO_RCVBUF || LWIP_FIONREAD_LINUXMODE
+      // Datagram sockets return length of next datagram with LWIP_FIONREAD_LINUXMODE,
+      // otherwise number of all queued bytes
+      if (*opt_len < sizeof(int32_t)) {
+        return IOT_SOCKET_EINVAL;
+      }
+      rc = ioctlsocket(socket, FIONREAD, opt_val);
+      if (rc == 0) {
+        *opt_len = sizeof(int32_t);
+      }
+#else
+      return IOT_SOCKET_ENOTSUP;
+#endif
+      break;
     case IOT_SOCKET_SO_RCVTIMEO: {
 #if LWIP_SO_SNDRCVTIMEO_NONSTANDARD
       rc = getsockopt(socket, SOL_SOCKET, SO_RCVTIMEO,  (char *)opt_val, opt_len);
@@ -602,6 +941,93 @@ int32_t iotSocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, uint32_t
     case IOT_SOCKET_SO_TYPE:
       rc = getsockopt(socket, SOL_SOCKET, SO_TYPE,      (char *)opt_val, opt_len);
       break;
+    case IOT_SOCKET_SO_BROADCAST:
+      rc = getsockopt(socket, SOL_SOCKET, SO_BROADCAST, (char *)opt_val, opt_len);
+      break;
+    case IOT_SOCKET_IP_TOS:
+      rc = getsockopt(socket, IPPROTO_IP, IP_TOS,       (char *)opt_val, opt_len);
+      break;
+    case IOT_SOCKET_SO_PRIORITY:
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_LINGER: {
+#if LWIP_SO_LINGER
+      struct linger lg;
+      uint32_t lg_len = sizeof(lg);
+      if (*opt_len < sizeof(int32_t)) {
+        return IOT_SOCKET_EINVAL;
+      }
+      rc = getsockopt(socket, SOL_SOCKET, SO_LINGER,    (char *)&lg, &lg_len);
+      if (rc == 0) {
+        *((int32_t *)opt_val) = lg.l_onoff ? lg.l_linger : -1;
+      }
+#else
+      return IOT_SOCKET_ENOTSUP;
+#endif
+    } break;
+    case IOT_SOCKET_SO_REUSEADDR:
+#if SO_REUSE
+      rc = getsockopt(socket, SOL_SOCKET, SO_REUSEADDR, (char *)opt_val, opt_len);
+#else
+      return IOT_SOCKET_ENOTSUP;
+#endif
+      break;
+    case IOT_SOCKET_TCP_NODELAY:
+      rc = getsockopt(socket, IPPROTO_TCP, TCP_NODELAY, (char *)opt_val, opt_len);
+      break;
+    case IOT_SOCKET_TCP_CORK:
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_RCVBUF:
+#if LWIP_SO_RCVBUF
+      rc = getsockopt(socket, SOL_SOCKET, SO_RCVBUF,    (char *)opt_val, opt_len);
+#else
+      return IOT_SOCKET_ENOTSUP;
+#endif
+      break;
+    case IOT_SOCKET_SO_SNDBUF:
+      return IOT_SOCKET_ENOTSUP;
+#if LWIP_TCP_KEEPALIVE
+    case IOT_SOCKET_TCP_KEEPIDLE:
+      rc = getsockopt(socket, IPPROTO_TCP, TCP_KEEPIDLE,  (char *)opt_val, opt_len);
+      break;
+    case IOT_SOCKET_TCP_KEEPINTVL:
+      rc = getsockopt(socket, IPPROTO_TCP, TCP_KEEPINTVL, (char *)opt_val, opt_len);
+      break;
+    case IOT_SOCKET_TCP_KEEPCNT:
+      rc = getsockopt(socket, IPPROTO_TCP, TCP_KEEPCNT,   (char *)opt_val, opt_len);
+      break;
+#else
+    case IOT_SOCKET_TCP_KEEPIDLE:
+    case IOT_SOCKET_TCP_KEEPINTVL:
+    case IOT_SOCKET_TCP_KEEPCNT:
+      return IOT_SOCKET_ENOTSUP;
+#endif
+#if LWIP_MULTICAST_TX_OPTIONS
+    case IOT_SOCKET_IP_MULTICAST_TTL:
+    case IOT_SOCKET_IP_MULTICAST_LOOP: {
+      // lwIP uses 8-bit values for multicast options
+      uint8_t  val;
+      uint32_t val_len = sizeof(val);
+      if (*opt_len < sizeof(int32_t)) {
+        return IOT_SOCKET_EINVAL;
+      }
+      rc = getsockopt(socket, IPPROTO_IP, (opt_id == IOT_SOCKET_IP_MULTICAST_TTL) ? IP_MULTICAST_TTL : IP_MULTICAST_LOOP,
+                      (char *)&val, &val_len);
+      if (rc == 0) {
+        *((int32_t *)opt_val) = val;
+      }
+    } break;
+#else
+    case IOT_SOCKET_IP_MULTICAST_TTL:
+    case IOT_SOCKET_IP_MULTICAST_LOOP:
+      return IOT_SOCKET_ENOTSUP;
+#endif
+    case IOT_SOCKET_IPV6_MULTICAST_HOPS:
+    case IOT_SOCKET_IPV6_MULTICAST_LOOP:
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_TIMESTAMP:
+    case IOT_SOCKET_SO_TIMESTAMP_TX:
+      // lwIP does not timestamp datagrams
+      return IOT_SOCKET_ENOTSUP;
     default:
       return IOT_SOCKET_EINVAL;
   }
@@ -659,9 +1085,170 @@ int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, ui
       break;
     case IOT_SOCKET_SO_TYPE:
       return IOT_SOCKET_EINVAL;
+    case IOT_SOCKET_SO_BROADCAST:
+      rc = setsockopt(socket, SOL_SOCKET, SO_BROADCAST, (const char *)opt_val, opt_len);
+      break;
+    case IOT_SOCKET_IP_TOS:
+      rc = setsockopt(socket, IPPROTO_IP, IP_TOS,       (const char *)opt_val, opt_len);
+      break;
+    case IOT_SOCKET_SO_PRIORITY:
+      // lwIP has no transmit priority, use IP_TOS to mark traffic
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_LINGER: {
+#if LWIP_SO_LINGER
+      struct linger lg;
+      if (opt_len != sizeof(int32_t)) {
+        return IOT_SOCKET_EINVAL;
+      }
+      lg.l_onoff  = (*(const int32_t *)opt_val >= 0) ? 1 : 0;
+      lg.l_linger = lg.l_onoff ? *(const int32_t *)opt_val : 0;
+      rc = setsockopt(socket, SOL_SOCKET, SO_LINGER,    (const char *)&lg, sizeof(lg));
+#else
+      // Lingering close requires LWIP_SO_LINGER
+      return IOT_SOCKET_ENOTSUP;
+#endif
+    } break;
+    case IOT_SOCKET_SO_REUSEADDR:
+#if SO_REUSE
+      rc = setsockopt(socket, SOL_SOCKET, SO_REUSEADDR, (const char *)opt_val, opt_len);
+#else
+      // Address reuse requires SO_REUSE
+      return IOT_SOCKET_ENOTSUP;
+#endif
+      break;
+    case IOT_SOCKET_TCP_NODELAY:
+      rc = setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, (const char *)opt_val, opt_len);
+      break;
+    case IOT_SOCKET_TCP_CORK:
+      // lwIP has no cork mode
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_RCVBUF:
+#if LWIP_SO_RCVBUF
+      rc = setsockopt(socket, SOL_SOCKET, SO_RCVBUF,    (const char *)opt_val, opt_len);
+#else
+      return IOT_SOCKET_ENOTSUP;
+#endif
+      break;
+    case IOT_SOCKET_SO_SNDBUF:
+    case IOT_SOCKET_TCP_WINDOW:
+      // Send buffer (TCP_SND_BUF) and window (TCP_WND) are global lwIP options
+      return IOT_SOCKET_ENOTSUP;
+#if LWIP_TCP_KEEPALIVE
+    case IOT_SOCKET_TCP_KEEPIDLE:
+      rc = setsockopt(socket, IPPROTO_TCP, TCP_KEEPIDLE,  (const char *)opt_val, opt_len);
+      break;
+    case IOT_SOCKET_TCP_KEEPINTVL:
+      rc = setsockopt(socket, IPPROTO_TCP, TCP_KEEPINTVL, (const char *)opt_val, opt_len);
+      break;
+    case IOT_SOCKET_TCP_KEEPCNT:
+      rc = setsockopt(socket, IPPROTO_TCP, TCP_KEEPCNT,   (const char *)opt_val, opt_len);
+      break;
+#else
+    case IOT_SOCKET_TCP_KEEPIDLE:
+    case IOT_SOCKET_TCP_KEEPINTVL:
+    case IOT_SOCKET_TCP_KEEPCNT:
+      // Keep-alive timing requires LWIP_TCP_KEEPALIVE
+      return IOT_SOCKET_ENOTSUP;
+#endif
+#if LWIP_IGMP
+    case IOT_SOCKET_IP_ADD_MEMBERSHIP:
+    case IOT_SOCKET_IP_DROP_MEMBERSHIP: {
+      const iotSocketMreq_t *mreq = (const iotSocketMreq_t *)opt_val;
+      struct ip_mreq imr;
+      if (opt_len != sizeof(iotSocketMreq_t)) {
+        return IOT_SOCKET_EINVAL;
+      }
+      memcpy(&imr.imr_multiaddr, mreq->group,  sizeof(imr.imr_multiaddr));
+      memcpy(&imr.imr_interface, mreq->ifaddr, sizeof(imr.imr_interface));
+      rc = setsockopt(socket, IPPROTO_IP, (opt_id == IOT_SOCKET_IP_ADD_MEMBERSHIP) ? IP_ADD_MEMBERSHIP : IP_DROP_MEMBERSHIP,
+                      (const char *)&imr, sizeof(imr));
+    } break;
+#else
+    case IOT_SOCKET_IP_ADD_MEMBERSHIP:
+    case IOT_SOCKET_IP_DROP_MEMBERSHIP:
+      // Multicast group membership requires LWIP_IGMP
+      return IOT_SOCKET_ENOTSUP;
+#endif
+#if LWIP_MULTICAST_TX_OPTIONS
+    case IOT_SOCKET_IP_MULTICAST_TTL:
+    case IOT_SOCKET_IP_MULTICAST_LOOP: {
+      // lwIP uses 8-bit values for multicast options
+      uint8_t val;
+      if (opt_len != sizeof(int32_t)) {
+        return IOT_SOCKET_EINVAL;
+      }
+      if (opt_id == IOT_SOCKET_IP_MULTICAST_TTL) {
+        if ((*(const int32_t *)opt_val < 0) || (*(const int32_t *)opt_val > 255)) {
+          return IOT_SOCKET_EINVAL;
+        }
+        val = (uint8_t)*(const int32_t *)opt_val;
+      } else {
+        val = *(const int32_t *)opt_val ? 1U : 0U;
+      }
+      rc = setsockopt(socket, IPPROTO_IP, (opt_id == IOT_SOCKET_IP_MULTICAST_TTL) ? IP_MULTICAST_TTL : IP_MULTICAST_LOOP,
+                      (const char *)&val, sizeof(val));
+    } break;
+#else
+    case IOT_SOCKET_IP_MULTICAST_TTL:
+    case IOT_SOCKET_IP_MULTICAST_LOOP:
+      // Multicast transmit options require LWIP_MULTICAST_TX_OPTIONS
+      return IOT_SOCKET_ENOTSUP;
+#endif
+#if defined(RTE_Network_IPv6) && LWIP_IPV6_MLD
+    case IOT_SOCKET_IPV6_JOIN_GROUP:
+    case IOT_SOCKET_IPV6_LEAVE_GROUP: {
+      const iotSocketMreq_t *mreq = (const iotSocketMreq_t *)opt_val;
+      struct ipv6_mreq imr;
+      if (opt_len != sizeof(iotSocketMreq_t)) {
+        return IOT_SOCKET_EINVAL;
+      }
+      memcpy(&imr.ipv6mr_multiaddr, mreq->group, sizeof(imr.ipv6mr_multiaddr));
+      imr.ipv6mr_interface = 0U;
+      rc = setsockopt(socket, IPPROTO_IPV6, (opt_id == IOT_SOCKET_IPV6_JOIN_GROUP) ? IPV6_JOIN_GROUP : IPV6_LEAVE_GROUP,
+                      (const char *)&imr, sizeof(imr));
+    } break;
+#else
+    case IOT_SOCKET_IPV6_JOIN_GROUP:
+    case IOT_SOCKET_IPV6_LEAVE_GROUP:
+      // IPv6 multicast group membership requires LWIP_IPV6_MLD
+      return IOT_SOCKET_ENOTSUP;
+#endif
+    case IOT_SOCKET_IPV6_MULTICAST_HOPS:
+    case IOT_SOCKET_IPV6_MULTICAST_LOOP:
+      // lwIP has no IPv6 multicast transmit options
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_TIMESTAMP:
+      // lwIP does not timestamp datagrams
+      return IOT_SOCKET_ENOTSUP;
+    default:
+      return IOT_SOCKET_EINVAL;
+  }
+  if (rc < 0) {
+    return errno_to_rc ();
+  }
+
+  return rc;
+}
+
+// Shut down part or all of a full-duplex connection
+int32_t iotSocketShutdown (int32_t socket, int32_t how) {
+  int32_t rc;
+
+  switch (how) {
+    case IOT_SOCKET_SHUT_RD:
+      how = SHUT_RD;
+      break;
+    case IOT_SOCKET_SHUT_WR:
+      how = SHUT_WR;
+      break;
+    case IOT_SOCKET_SHUT_RDWR:
+      how = SHUT_RDWR;
+      break;
     default:
       return IOT_SOCKET_EINVAL;
   }
+
+  rc = shutdown(socket, how);
   if (rc < 0) {
     return errno_to_rc ();
   }
@@ -738,3 +1325,110 @@ int32_t iotSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint3
 
   return 0;
 }
+
+// Retrieve all host IP addresses from host name
+// (lwIP getaddrinfo returns at most one address per address family)
+int32_t iotSocketGetAddrInfo (const char *name, int32_t af, iotSocketAddr_t *addrs, uint32_t *count, uint32_t *ttls) {
+  struct addrinfo hints, *res, *ai;
+  int32_t  family[2];
+  uint32_t num_family, num, i;
+  int      err;
+
+  // Check parameters
+  if ((name == NULL) || (addrs == NULL) || (count == NULL) || (*count == 0U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  switch (af) {
+    case IOT_SOCKET_AF_UNSPEC:
+#if defined(RTE_Network_IPv6)
+      family[0]  = AF_INET6;
+      family[1]  = AF_INET;
+      num_family = 2U;
+#else
+      family[0]  = AF_INET;
+      num_family = 1U;
+#endif
+      break;
+    case IOT_SOCKET_AF_INET:
+      family[0]  = AF_INET;
+      num_family = 1U;
+      break;
+#if defined(RTE_Network_IPv6)
+    case IOT_SOCKET_AF_INET6:
+      family[0]  = AF_INET6;
+      num_family = 1U;
+      break;
+#endif
+    default:
+      return IOT_SOCKET_EINVAL;
+  }
+
+  // Resolve hostname, one query per address family
+  num = 0U;
+  err = 0;
+  for (i = 0U; (i < num_family) && (num < *count); i++) {
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = family[i];
+    err = getaddrinfo(name, NULL, &hints, &res);
+    if (err != 0) {
+      continue;
+    }
+
+    // Copy resolved IP address (lwIP returns a single entry)
+    for (ai = res; (ai != NULL) && (num < *count); ai = ai->ai_next) {
+      if (ai->ai_family == AF_INET) {
+        struct sockaddr_in *sa = (struct sockaddr_in *)ai->ai_addr;
+        memcpy(addrs[num].ip, &sa->sin_addr, sizeof(struct in_addr));
+        addrs[num].ip_len = sizeof(struct in_addr);
+      }
+#if defined(RTE_Network_IPv6)
+      else if (ai->ai_family == AF_INET6) {
+        struct sockaddr_in6 *sa = (struct sockaddr_in6 *)ai->ai_addr;
+        memcpy(addrs[num].ip, &sa->sin6_addr, sizeof(struct in6_addr));
+        addrs[num].ip_len = sizeof(struct in6_addr);
+      }
+#endif
+      else {
+        continue;
+      }
+      if (ttls != NULL) {
+        // lwIP does not report the record TTL
+        ttls[num] = 0U;
+      }
+      num++;
+    }
+    freeaddrinfo(res);
+  }
+
+  if (num == 0U) {
+    switch (err) {
+      case 0:
+      case EAI_NONAME:
+        return IOT_SOCKET_EHOSTNOTFOUND;
+      case EAI_MEMORY:
+        return IOT_SOCKET_ENOMEM;
+      default:
+        return IOT_SOCKET_ERROR;
+    }
+  }
+  *count = num;
+
+  return 0;
+}
+
+// Retrieve directed broadcast address of the local network
+int32_t iotSocketGetBroadcastAddr (uint8_t *ip, uint32_t *ip_len) {
+  int32_t rc;
+
+  // Check parameters
+  if ((ip == NULL) || (ip_len == NULL) || (*ip_len < sizeof(struct in_addr))) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  rc = get_broadcast(ip);
+  if (rc == 0) {
+    *ip_len = sizeof(struct in_addr);
+  }
+
+  return rc;
+}
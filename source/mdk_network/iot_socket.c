@@ -19,6 +19,7 @@
 #include <string.h>
 #include "iot_socket.h"
 #include "rl_net.h"
+#include "cmsis_os2.h"
 #include "RTE_Components.h"
 
 // Import number of available BSD sockets
@@ -44,7 +45,8 @@
 // Socket attributes
 struct {
   uint32_t ionbio  : 1;
-  uint32_t tv_sec  : 21;
+  uint32_t bcast   : 1;
+  uint32_t tv_sec  : 20;
   uint32_t tv_msec : 10;
 } sock_attr[NUM_SOCKS];
 
@@ -167,7 +169,7 @@ int32_t iotSocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint1
   int32_t rc;
 
   // Check parameters
-  if ((ip == NULL) || (port == 0)) {
+  if (ip == NULL) {
     return IOT_SOCKET_EINVAL;
   }
 
@@ -292,8 +294,8 @@ int32_t iotSocketConnect (int32_t socket, const uint8_t *ip, uint32_t ip_len, ui
   return rc;
 }
 
-// Check if socket is readable
-static int32_t socket_check_read (int32_t socket) {
+// Check if socket is readable (without waiting when dontwait is set)
+static int32_t socket_check_read (int32_t socket, uint32_t dontwait) {
   timeval tv, *ptv;
   fd_set  fds;
   int32_t nr;
@@ -306,7 +308,7 @@ static int32_t socket_check_read (int32_t socket) {
   FD_SET(socket, &fds);
   ptv = &tv;
   memset (&tv, 0, sizeof(tv));
-  if (!sock_attr[socket-1].ionbio) {
+  if (!sock_attr[socket-1].ionbio && !dontwait) {
     tv.tv_sec  = sock_attr[socket-1].tv_sec;
     tv.tv_usec = sock_attr[socket-1].tv_msec * 1000;
     if ((tv.tv_sec == 0U) && (tv.tv_usec == 0U)) {
@@ -325,7 +327,7 @@ int32_t iotSocketRecv (int32_t socket, void *buf, uint32_t len) {
   int32_t rc;
 
   if (len == 0U) {
-    return socket_check_read (socket);
+    return socket_check_read (socket, 0U);
   }
 
   rc = recv(socket, buf, (int32_t)len, 0);
@@ -347,7 +349,7 @@ int32_t iotSocketRecvFrom (int32_t socket, void *buf, uint32_t len, uint8_t *ip,
   int32_t rc;
 
   if (len == 0U) {
-    return socket_check_read (socket);
+    return socket_check_read (socket, 0U);
   }
 
   rc = recvfrom(socket, buf, (int32_t)len, 0, (SOCKADDR *)&addr, &addr_len);
@@ -429,6 +431,41 @@ int32_t iotSocketSend (int32_t socket, const void *buf, uint32_t len) {
   return rc;
 }
 
+// Get directed broadcast address of the Ethernet interface
+static int32_t get_broadcast (uint8_t *ip) {
+  uint8_t addr[NET_ADDR_IP4_LEN];
+  uint8_t mask[NET_ADDR_IP4_LEN];
+  uint32_t i;
+
+  if ((netIF_GetOption (NET_IF_CLASS_ETH | 0, netIF_OptionIP4_Address,    addr, sizeof(addr)) != netOK) ||
+      (netIF_GetOption (NET_IF_CLASS_ETH | 0, netIF_OptionIP4_SubnetMask, mask, sizeof(mask)) != netOK)) {
+    return IOT_SOCKET_ERROR;
+  }
+  if ((addr[0] | addr[1] | addr[2] | addr[3]) == 0U) {
+    // Interface not configured
+    return IOT_SOCKET_ENOTCONN;
+  }
+  for (i = 0U; i < NET_ADDR_IP4_LEN; i++) {
+    ip[i] = addr[i] | (uint8_t)~mask[i];
+  }
+
+  return 0;
+}
+
+// Check if sending to IPv4 address is permitted (SO_BROADCAST for broadcast addresses)
+static int32_t check_broadcast (int32_t socket, const uint8_t *ip) {
+  uint8_t bcast[NET_ADDR_IP4_LEN];
+
+  if ((socket < 1) || (socket > NUM_SOCKS) || sock_attr[socket-1].bcast) {
+    return 0;
+  }
+  if ((memcmp(ip, "\xFF\xFF\xFF\xFF", NET_ADDR_IP4_LEN) == 0) ||
+      ((get_broadcast(bcast) == 0) && (memcmp(ip, bcast, NET_ADDR_IP4_LEN) == 0))) {
+    return IOT_SOCKET_EINVAL;
+  }
+  return 0;
+}
+
 // Send data on a socket
 int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port) {
   SOCKADDR_STORAGE addr;
@@ -444,6 +481,10 @@ int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const ui
     switch (ip_len) {
       case NET_ADDR_IP4_LEN: {
         SOCKADDR_IN *sa = (SOCKADDR_IN *)&addr;
+        rc = check_broadcast(socket, ip);
+        if (rc < 0) {
+          return rc;
+        }
         sa->sin_family = AF_INET;
         memcpy(&sa->sin_addr, ip, NET_ADDR_IP4_LEN);
         sa->sin_port = htons(port);
@@ -477,6 +518,258 @@ int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const ui
   return rc;
 }
 
+// Receive data on a connected socket with message flags
+int32_t iotSocketRecvEx (int32_t socket, void *buf, uint32_t len, uint32_t flags) {
+  int32_t  type     = SOCK_STREAM;
+  int32_t  type_len = sizeof(type);
+  int32_t  msg_flags;
+  uint32_t num;
+  int32_t  rc;
+
+  if ((flags & ~(IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_DONTWAIT | IOT_SOCKET_MSG_WAITALL | IOT_SOCKET_MSG_TRUNC)) != 0U) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((flags & (IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_WAITALL)) == (IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_WAITALL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if (len == 0U) {
+    return socket_check_read (socket, flags & IOT_SOCKET_MSG_DONTWAIT);
+  }
+
+  msg_flags = 0;
+  if ((flags & IOT_SOCKET_MSG_PEEK) != 0U) {
+    msg_flags |= MSG_PEEK;
+  }
+  if ((flags & IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+    msg_flags |= MSG_DONTWAIT;
+  }
+  if ((flags & (IOT_SOCKET_MSG_WAITALL | IOT_SOCKET_MSG_TRUNC)) != 0U) {
+    rc = getsockopt(socket, SOL_SOCKET, SO_TYPE, (char *)&type, &type_len);
+    if (rc < 0) {
+      return rc_bsd_to_iot(rc);
+    }
+  }
+  if ((type == SOCK_DGRAM) && ((flags & IOT_SOCKET_MSG_TRUNC) != 0U)) {
+    // BSD sockets of the Network Component do not report the length of truncated datagrams
+    return IOT_SOCKET_ENOTSUP;
+  }
+
+  num = 0U;
+  do {
+    rc = recv(socket, (char *)buf + num, (int32_t)(len - num), msg_flags);
+    if (rc <= 0) {
+      break;
+    }
+    num += (uint32_t)rc;
+  } while ((type == SOCK_STREAM) && ((flags & IOT_SOCKET_MSG_WAITALL) != 0U) && (num < len));
+
+  if (num != 0U) {
+    // Return received data, error is reported on the next call
+    return (int32_t)num;
+  }
+  if (rc < 0) {
+    if (rc == BSD_ETIMEDOUT) {
+      rc = IOT_SOCKET_EAGAIN;
+    } else {
+      rc = rc_bsd_to_iot(rc);
+    }
+  }
+
+  return rc;
+}
+
+// Send data on a connected socket with message flags
+int32_t iotSocketSendEx (int32_t socket, const void *buf, uint32_t len, uint32_t flags) {
+  int32_t rc;
+
+  if ((flags & ~IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if (len == 0U) {
+    return socket_check_write (socket);
+  }
+
+  rc = send(socket, buf, (int32_t)len, (flags & IOT_SOCKET_MSG_DONTWAIT) ? MSG_DONTWAIT : 0);
+  if (rc < 0) {
+    if (rc == BSD_ETIMEDOUT) {
+      rc = IOT_SOCKET_EAGAIN;
+    } else {
+      rc = rc_bsd_to_iot(rc);
+    }
+  }
+
+  return rc;
+}
+
+// Update time budget with the time elapsed since start (in kernel ticks)
+static void timeout_update (uint32_t start, uint32_t *timeout) {
+  uint32_t elapsed;
+
+  elapsed = (uint32_t)(((uint64_t)(osKernelGetTickCount() - start) * 1000U) / osKernelGetTickFreq());
+  *timeout = (elapsed < *timeout) ? (*timeout - elapsed) : 0U;
+}
+
+// Wait until socket is readable (or writable) within the time budget
+static int32_t socket_wait (int32_t socket, uint32_t write, uint32_t *timeout) {
+  timeval  tv;
+  fd_set   fds;
+  uint32_t start;
+  int32_t  nr;
+
+  if (socket <= 0 || socket > NUM_SOCKS) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  FD_ZERO(&fds);
+  FD_SET(socket, &fds);
+  tv.tv_sec  = (long)(*timeout / 1000U);
+  tv.tv_usec = (long)(*timeout % 1000U) * 1000;
+  start = osKernelGetTickCount();
+  if (write) {
+    nr = select (socket+1, NULL, &fds, NULL, &tv);
+  } else {
+    nr = select (socket+1, &fds, NULL, NULL, &tv);
+  }
+  timeout_update (start, timeout);
+  if (nr < 0) {
+    return rc_bsd_to_iot(nr);
+  }
+  if (nr == 0) {
+    *timeout = 0U;
+    return IOT_SOCKET_ETIMEDOUT;
+  }
+  return 0;
+}
+
+// Accept a new connection on a socket within a time budget
+int32_t iotSocketAcceptTimed (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port, uint32_t *timeout) {
+  int32_t rc;
+
+  if (timeout == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Listening socket is readable when a connection request is pending
+  rc = socket_wait (socket, 0U, timeout);
+  if (rc < 0) {
+    return rc;
+  }
+  return iotSocketAccept (socket, ip, ip_len, port);
+}
+
+// Connect a socket to a remote host within a time budget
+int32_t iotSocketConnectTimed (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port, uint32_t *timeout) {
+  unsigned long nbio;
+  int32_t rc;
+
+  if (timeout == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if (socket <= 0 || socket > NUM_SOCKS) {
+    return IOT_SOCKET_ESOCK;
+  }
+
+  // Connect in non-blocking mode, the receive timeout is not used
+  if (!sock_attr[socket-1].ionbio) {
+    nbio = 1U;
+    ioctlsocket(socket, FIONBIO, &nbio);
+  }
+
+  rc = iotSocketConnect (socket, ip, ip_len, port);
+  if ((rc == IOT_SOCKET_EINPROGRESS) || (rc == IOT_SOCKET_EALREADY)) {
+    // Socket becomes writable when the connection is established
+    rc = socket_wait (socket, 1U, timeout);
+    if (rc == 0) {
+      rc = iotSocketConnect (socket, ip, ip_len, port);
+    }
+  }
+  if (rc == IOT_SOCKET_EISCONN) {
+    rc = 0;
+  }
+
+  if (!sock_attr[socket-1].ionbio) {
+    nbio = 0U;
+    ioctlsocket(socket, FIONBIO, &nbio);
+  }
+
+  return rc;
+}
+
+// Receive data on a connected socket within a time budget
+int32_t iotSocketRecvTimed (int32_t socket, void *buf, uint32_t len, uint32_t *timeout) {
+  int32_t rc;
+
+  if ((buf == NULL) || (len == 0U) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  for (;;) {
+    rc = socket_wait (socket, 0U, timeout);
+    if (rc < 0) {
+      break;
+    }
+    rc = recv(socket, buf, (int32_t)len, MSG_DONTWAIT);
+    if (rc >= 0) {
+      break;
+    }
+    rc = rc_bsd_to_iot(rc);
+    if (rc != IOT_SOCKET_EAGAIN) {
+      break;
+    }
+    if (*timeout == 0U) {
+      // Data was consumed by another thread
+      rc = IOT_SOCKET_ETIMEDOUT;
+      break;
+    }
+  }
+
+  return rc;
+}
+
+// Send data on a connected socket within a time budget
+int32_t iotSocketSendTimed (int32_t socket, const void *buf, uint32_t len, uint32_t *timeout) {
+  int32_t rc;
+
+  if ((buf == NULL) || (len == 0U) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  for (;;) {
+    rc = socket_wait (socket, 1U, timeout);
+    if (rc < 0) {
+      break;
+    }
+    rc = send(socket, buf, (int32_t)len, MSG_DONTWAIT);
+    if (rc >= 0) {
+      break;
+    }
+    rc = rc_bsd_to_iot(rc);
+    if (rc != IOT_SOCKET_EAGAIN) {
+      break;
+    }
+    if (*timeout == 0U) {
+      rc = IOT_SOCKET_ETIMEDOUT;
+      break;
+    }
+  }
+
+  return rc;
+}
+
+// Receive data on a socket together with its receive timestamp
+int32_t iotSocketRecvFromTs (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port, iotSocketTimestamp_t *ts) {
+  (void)socket;
+  (void)buf;
+  (void)len;
+  (void)ip;
+  (void)ip_len;
+  (void)port;
+  (void)ts;
+
+  // BSD sockets of the Network Component do not report the receive time
+  return IOT_SOCKET_ENOTSUP;
+}
+
 // Retrieve local IP address and port of a socket
 int32_t iotSocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
   SOCKADDR_STORAGE addr;
@@ -594,6 +887,56 @@ int32_t iotSocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, uint32_t
     case IOT_SOCKET_SO_TYPE:
       rc = getsockopt(socket, SOL_SOCKET, SO_TYPE,      (char *)opt_val, (int32_t *)opt_len);
       break;
+    case IOT_SOCKET_SO_BROADCAST:
+      // Broadcast permission is checked by iotSocketSendTo
+      if ((socket < 1) || (socket > NUM_SOCKS)) {
+        return IOT_SOCKET_ESOCK;
+      }
+      if ((opt_val == NULL) || (opt_len == NULL) || (*opt_len < sizeof(int32_t))) {
+        return IOT_SOCKET_EINVAL;
+      }
+      *(int32_t *)opt_val = sock_attr[socket-1].bcast;
+      *opt_len = sizeof(int32_t);
+      return 0;
+    case IOT_SOCKET_IP_TOS:
+      rc = getsockopt(socket, IPPROTO_IP, IP_TOS,       (char *)opt_val, (int32_t *)opt_len);
+      break;
+    case IOT_SOCKET_SO_PRIORITY:
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_TCP_NODELAY:
+      // Stream sockets send data without delay (no Nagle algorithm)
+      if ((opt_val == NULL) || (opt_len == NULL) || (*opt_len < sizeof(int32_t))) {
+        return IOT_SOCKET_EINVAL;
+      }
+      *(int32_t *)opt_val = 1;
+      *opt_len = sizeof(int32_t);
+      return 0;
+    case IOT_SOCKET_TCP_CORK:
+    case IOT_SOCKET_SO_RCVBUF:
+    case IOT_SOCKET_SO_SNDBUF:
+    case IOT_SOCKET_TCP_KEEPIDLE:
+    case IOT_SOCKET_TCP_KEEPINTVL:
+    case IOT_SOCKET_TCP_KEEPCNT:
+    case IOT_SOCKET_IP_MULTICAST_TTL:
+    case IOT_SOCKET_IP_MULTICAST_LOOP:
+    case IOT_SOCKET_IPV6_MULTICAST_LOOP:
+    case IOT_SOCKET_SO_LINGER:
+    case IOT_SOCKET_SO_REUSEADDR:
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_IO_FIONREAD:
+      // BSD sockets of the Network Component do not report the amount of received data
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_TIMESTAMP:
+    case IOT_SOCKET_SO_TIMESTAMP_TX:
+      // Datagram timestamping is not provided by the BSD layer of the Network Component
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_IPV6_MULTICAST_HOPS:
+#ifdef Network_IPv6
+      rc = getsockopt(socket, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, (char *)opt_val, (int32_t *)opt_len);
+      break;
+#else
+      return IOT_SOCKET_ENOTSUP;
+#endif
     default:
       return IOT_SOCKET_EINVAL;
   }
@@ -631,6 +974,99 @@ int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, ui
       break;
     case IOT_SOCKET_SO_TYPE:
       return IOT_SOCKET_EINVAL;
+    case IOT_SOCKET_SO_BROADCAST: {
+      // Broadcast permission is checked by iotSocketSendTo
+      int32_t type, type_len = sizeof(type);
+      if ((socket < 1) || (socket > NUM_SOCKS)) {
+        return IOT_SOCKET_ESOCK;
+      }
+      if ((opt_val == NULL) || (opt_len != sizeof(int32_t))) {
+        return IOT_SOCKET_EINVAL;
+      }
+      rc = getsockopt(socket, SOL_SOCKET, SO_TYPE, (char *)&type, &type_len);
+      if (rc < 0) {
+        return rc_bsd_to_iot(rc);
+      }
+      if (type != SOCK_DGRAM) {
+        return IOT_SOCKET_EINVAL;
+      }
+      sock_attr[socket-1].bcast = *(const int32_t *)opt_val ? 1 : 0;
+      return 0;
+    }
+    case IOT_SOCKET_IP_TOS:
+      rc = setsockopt(socket, IPPROTO_IP, IP_TOS,       (const char *)opt_val, (int32_t)opt_len);
+      break;
+    case IOT_SOCKET_SO_PRIORITY:
+      // Network Component has no transmit priority, use IP_TOS to mark traffic
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_TCP_NODELAY:
+      // Stream sockets send data without delay (no Nagle algorithm)
+      if ((opt_val == NULL) || (opt_len != sizeof(int32_t))) {
+        return IOT_SOCKET_EINVAL;
+      }
+      if (*(const int32_t *)opt_val == 0) {
+        return IOT_SOCKET_ENOTSUP;
+      }
+      return 0;
+    case IOT_SOCKET_TCP_CORK:
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_RCVBUF:
+    case IOT_SOCKET_SO_SNDBUF:
+    case IOT_SOCKET_TCP_WINDOW:
+      // Receive window is configured globally (TCP_RECEIVE_WIN_SIZE in Net_Config_TCP.h)
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_TCP_KEEPIDLE:
+    case IOT_SOCKET_TCP_KEEPINTVL:
+    case IOT_SOCKET_TCP_KEEPCNT:
+      // Keep-alive timing is configured globally (TCP_DEFAULT_TOUT in Net_Config_TCP.h)
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_IP_ADD_MEMBERSHIP:
+    case IOT_SOCKET_IP_DROP_MEMBERSHIP: {
+      // Group membership applies to the Ethernet interface (IGMP in Net_Config_ETH_0.h)
+      netStatus stat;
+      if ((opt_val == NULL) || (opt_len != sizeof(iotSocketMreq_t))) {
+        return IOT_SOCKET_EINVAL;
+      }
+      if (opt_id == IOT_SOCKET_IP_ADD_MEMBERSHIP) {
+        stat = netIGMP_Join (NET_IF_CLASS_ETH | 0, ((const iotSocketMreq_t *)opt_val)->group);
+      } else {
+        stat = netIGMP_Leave(NET_IF_CLASS_ETH | 0, ((const iotSocketMreq_t *)opt_val)->group);
+      }
+      switch (stat) {
+        case netOK:
+          return 0;
+        case netInvalidParameter:
+          return IOT_SOCKET_EINVAL;
+        case netWrongState:
+          // IGMP not enabled
+          return IOT_SOCKET_ENOTSUP;
+        default:
+          return IOT_SOCKET_ERROR;
+      }
+    }
+    case IOT_SOCKET_IP_MULTICAST_TTL:
+      // Time-to-live is configured globally (ETH0_IP4_TTL in Net_Config_ETH_0.h)
+    case IOT_SOCKET_IP_MULTICAST_LOOP:
+    case IOT_SOCKET_IPV6_JOIN_GROUP:
+    case IOT_SOCKET_IPV6_LEAVE_GROUP:
+    case IOT_SOCKET_IPV6_MULTICAST_LOOP:
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_LINGER:
+      // closesocket always closes gracefully, the socket is released when the peer acknowledges FIN
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_REUSEADDR:
+      // Address reuse is not provided by the BSD layer of the Network Component
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_SO_TIMESTAMP:
+      // Datagram timestamping is not provided by the BSD layer of the Network Component
+      return IOT_SOCKET_ENOTSUP;
+    case IOT_SOCKET_IPV6_MULTICAST_HOPS:
+#ifdef Network_IPv6
+      rc = setsockopt(socket, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, (const char *)opt_val, (int32_t)opt_len);
+      break;
+#else
+      return IOT_SOCKET_ENOTSUP;
+#endif
     default:
       return IOT_SOCKET_EINVAL;
   }
@@ -639,6 +1075,20 @@ int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, ui
   return rc;
 }
 
+// Shut down part or all of a full-duplex connection
+int32_t iotSocketShutdown (int32_t socket, int32_t how) {
+
+  if ((socket < 1) || (socket > NUM_SOCKS)) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((how != IOT_SOCKET_SHUT_RD) && (how != IOT_SOCKET_SHUT_WR) && (how != IOT_SOCKET_SHUT_RDWR)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // BSD sockets of the Network Component have no half-close
+  return IOT_SOCKET_ENOTSUP;
+}
+
 // Close and release a socket
 int32_t iotSocketClose (int32_t socket) {
   int32_t rc;
@@ -715,3 +1165,105 @@ int32_t iotSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint3
 
   return 0;
 }
+
+// Retrieve all host IP addresses from host name
+int32_t iotSocketGetAddrInfo (const char *name, int32_t af, iotSocketAddr_t *addrs, uint32_t *count, uint32_t *ttls) {
+  netStatus stat;
+  NET_ADDR  addr;
+  int16_t   addr_type[2];
+  uint32_t  num_type, num, i;
+
+  // Check parameters
+  if ((name == NULL) || (addrs == NULL) || (count == NULL) || (*count == 0U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  switch (af) {
+    case IOT_SOCKET_AF_UNSPEC:
+#ifdef Network_IPv6
+      addr_type[0] = NET_ADDR_IP6;
+      addr_type[1] = NET_ADDR_IP4;
+      num_type     = 2U;
+#else
+      addr_type[0] = NET_ADDR_IP4;
+      num_type     = 1U;
+#endif
+      break;
+    case IOT_SOCKET_AF_INET:
+      addr_type[0] = NET_ADDR_IP4;
+      num_type     = 1U;
+      break;
+#ifdef Network_IPv6
+    case IOT_SOCKET_AF_INET6:
+      addr_type[0] = NET_ADDR_IP6;
+      num_type     = 1U;
+      break;
+#endif
+    default:
+      return IOT_SOCKET_EINVAL;
+  }
+
+  // Resolve hostname, DNS client returns one address per address type
+  num  = 0U;
+  stat = netError;
+  for (i = 0U; (i < num_type) && (num < *count); i++) {
+    stat = netDNSc_GetHostByNameX(name, addr_type[i], &addr);
+    if (stat != netOK) {
+      continue;
+    }
+
+    // Copy resolved IP address
+    switch (addr.addr_type) {
+      case NET_ADDR_IP4:
+        memcpy(addrs[num].ip, &addr.addr, NET_ADDR_IP4_LEN);
+        addrs[num].ip_len = NET_ADDR_IP4_LEN;
+        break;
+#ifdef Network_IPv6
+      case NET_ADDR_IP6:
+        memcpy(addrs[num].ip, &addr.addr, NET_ADDR_IP6_LEN);
+        addrs[num].ip_len = NET_ADDR_IP6_LEN;
+        break;
+#endif
+      default:
+        continue;
+    }
+    if (ttls != NULL) {
+      // DNS client does not report the record TTL
+      ttls[num] = 0U;
+    }
+    num++;
+  }
+
+  if (num == 0U) {
+    switch (stat) {
+      case netInvalidParameter:
+        return IOT_SOCKET_EINVAL;
+      case netTimeout:
+        return IOT_SOCKET_ETIMEDOUT;
+      case netOK:
+      case netDnsResolverError:
+        return IOT_SOCKET_EHOSTNOTFOUND;
+      default:
+        return IOT_SOCKET_ERROR;
+    }
+  }
+  *count = num;
+
+  return 0;
+}
+
+// Retrieve directed broadcast address of the local network
+int32_t iotSocketGetBroadcastAddr (uint8_t *ip, uint32_t *ip_len) {
+  int32_t rc;
+
+  // Check parameters
+  if ((ip == NULL) || (ip_len == NULL) || (*ip_len < NET_ADDR_IP4_LEN)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  rc = get_broadcast(ip);
+  if (rc == 0) {
+    *ip_len = NET_ADDR_IP4_LEN;
+  }
+
+  return rc;
+}
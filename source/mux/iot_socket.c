@@ -139,6 +139,104 @@ int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const ui
   return rc;
 }
 
+// Receive data on a connected socket with message flags
+int32_t iotSocketRecvEx (int32_t socket, void *buf, uint32_t len, uint32_t flags) {
+  int32_t rc;
+
+  if (SocketApi == NULL) {
+    rc = IOT_SOCKET_ERROR;
+  } else if (SocketApi->SocketRecvEx == NULL) {
+    rc = IOT_SOCKET_ENOTSUP;
+  } else {
+    rc = SocketApi->SocketRecvEx (socket, buf, len, flags);
+  }
+  return rc;
+}
+
+// Send data on a connected socket with message flags
+int32_t iotSocketSendEx (int32_t socket, const void *buf, uint32_t len, uint32_t flags) {
+  int32_t rc;
+
+  if (SocketApi == NULL) {
+    rc = IOT_SOCKET_ERROR;
+  } else if (SocketApi->SocketSendEx == NULL) {
+    rc = IOT_SOCKET_ENOTSUP;
+  } else {
+    rc = SocketApi->SocketSendEx (socket, buf, len, flags);
+  }
+  return rc;
+}
+
+// Accept a new connection on a socket within a time budget
+int32_t iotSocketAcceptTimed (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port, uint32_t *timeout) {
+  int32_t rc;
+
+  if (SocketApi == NULL) {
+    rc = IOT_SOCKET_ERROR;
+  } else if (SocketApi->SocketAcceptTimed == NULL) {
+    rc = IOT_SOCKET_ENOTSUP;
+  } else {
+    rc = SocketApi->SocketAcceptTimed (socket, ip, ip_len, port, timeout);
+  }
+  return rc;
+}
+
+// Connect a socket to a remote host within a time budget
+int32_t iotSocketConnectTimed (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port, uint32_t *timeout) {
+  int32_t rc;
+
+  if (SocketApi == NULL) {
+    rc = IOT_SOCKET_ERROR;
+  } else if (SocketApi->SocketConnectTimed == NULL) {
+    rc = IOT_SOCKET_ENOTSUP;
+  } else {
+    rc = SocketApi->SocketConnectTimed (socket, ip, ip_len, port, timeout);
+  }
+  return rc;
+}
+
+// Receive data on a connected socket within a time budget
+int32_t iotSocketRecvTimed (int32_t socket, void *buf, uint32_t len, uint32_t *timeout) {
+  int32_t rc;
+
+  if (SocketApi == NULL) {
+    rc = IOT_SOCKET_ERROR;
+  } else if (SocketApi->SocketRecvTimed == NULL) {
+    rc = IOT_SOCKET_ENOTSUP;
+  } else {
+    rc = SocketApi->SocketRecvTimed (socket, buf, len, timeout);
+  }
+  return rc;
+}
+
+// Send data on a connected socket within a time budget
+int32_t iotSocketSendTimed (int32_t socket, const void *buf, uint32_t len, uint32_t *timeout) {
+  int32_t rc;
+
+  if (SocketApi == NULL) {
+    rc = IOT_SOCKET_ERROR;
+  } else if (SocketApi->SocketSendTimed == NULL) {
+    rc = IOT_SOCKET_ENOTSUP;
+  } else {
+    rc = SocketApi->SocketSendTimed (socket, buf, len, timeout);
+  }
+  return rc;
+}
+
+// Receive data on a socket together with its receive timestamp
+int32_t iotSocketRecvFromTs (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port, iotSocketTimestamp_t *ts) {
+  int32_t rc;
+
+  if (SocketApi == NULL) {
+    rc = IOT_SOCKET_ERROR;
+  } else if (SocketApi->SocketRecvFromTs == NULL) {
+    rc = IOT_SOCKET_ENOTSUP;
+  } else {
+    rc = SocketApi->SocketRecvFromTs (socket, buf, len, ip, ip_len, port, ts);
+  }
+  return rc;
+}
+
 // Retrieve local IP address and port of a socket
 int32_t iotSocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
   int32_t rc;
@@ -187,6 +285,20 @@ int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, ui
   return rc;
 }
 
+// Shut down part or all of a full-duplex connection
+int32_t iotSocketShutdown (int32_t socket, int32_t how) {
+  int32_t rc;
+
+  if (SocketApi == NULL) {
+    rc = IOT_SOCKET_ERROR;
+  } else if (SocketApi->SocketShutdown == NULL) {
+    rc = IOT_SOCKET_ENOTSUP;
+  } else {
+    rc = SocketApi->SocketShutdown (socket, how);
+  }
+  return rc;
+}
+
 // Close and release a socket
 int32_t iotSocketClose (int32_t socket) {
   int32_t rc;
@@ -210,3 +322,31 @@ int32_t iotSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint3
   }
   return rc;
 }
+
+// Retrieve all host IP addresses from host name
+int32_t iotSocketGetAddrInfo (const char *name, int32_t af, iotSocketAddr_t *addrs, uint32_t *count, uint32_t *ttls) {
+  int32_t rc;
+
+  if (SocketApi == NULL) {
+    rc = IOT_SOCKET_ERROR;
+  } else if (SocketApi->SocketGetAddrInfo == NULL) {
+    rc = IOT_SOCKET_ENOTSUP;
+  } else {
+    rc = SocketApi->SocketGetAddrInfo (name, af, addrs, count, ttls);
+  }
+  return rc;
+}
+
+// Retrieve directed broadcast address of the local network
+int32_t iotSocketGetBroadcastAddr (uint8_t *ip, uint32_t *ip_len) {
+  int32_t rc;
+
+  if (SocketApi == NULL) {
+    rc = IOT_SOCKET_ERROR;
+  } else if (SocketApi->SocketGetBroadcastAddr == NULL) {
+    rc = IOT_SOCKET_ENOTSUP;
+  } else {
+    rc = SocketApi->SocketGetBroadcastAddr (ip, ip_len);
+  }
+  return rc;
+}
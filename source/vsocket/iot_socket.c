@@ -277,6 +277,221 @@ int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const ui
   return io.ret_val;
 }
 
+// Receive data on a connected socket with message flags
+int32_t iotSocketRecvEx (int32_t socket, void *buf, uint32_t len, uint32_t flags) {
+  volatile vSocketRecvIO_t io;
+  int32_t  type     = IOT_SOCKET_SOCK_STREAM;
+  uint32_t type_len = sizeof(type);
+  uint32_t num;
+  int32_t  rc;
+
+  if ((socket < 0) || (socket >= NUM_SOCKS)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((flags & ~(IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_DONTWAIT | IOT_SOCKET_MSG_WAITALL | IOT_SOCKET_MSG_TRUNC)) != 0U) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((flags & (IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_TRUNC)) != 0U) {
+    // VSocket peripheral has no receive flags
+    return IOT_SOCKET_ENOTSUP;
+  }
+  if ((flags & IOT_SOCKET_MSG_WAITALL) != 0U) {
+    rc = iotSocketGetOpt(socket, IOT_SOCKET_SO_TYPE, &type, &type_len);
+    if (rc < 0) {
+      return rc;
+    }
+  }
+
+  num = 0U;
+  do {
+    if ((flags & IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+      // Single non-blocking call
+      io.param.socket = socket;
+      io.param.buf    = (uint8_t *)buf + num;
+      io.param.len    = len - num;
+      __DSB();
+
+      ARM_VSOCKET->vSocketRecvIO = &io;
+      __DSB();
+      rc = io.ret_val;
+    } else {
+      rc = iotSocketRecv(socket, (uint8_t *)buf + num, len - num);
+    }
+    if (rc <= 0) {
+      break;
+    }
+    num += (uint32_t)rc;
+  } while ((type == IOT_SOCKET_SOCK_STREAM) && ((flags & IOT_SOCKET_MSG_WAITALL) != 0U) && (num < len));
+
+  if (num != 0U) {
+    // Return received data, error is reported on the next call
+    return (int32_t)num;
+  }
+
+  return rc;
+}
+
+// Send data on a connected socket with message flags
+int32_t iotSocketSendEx (int32_t socket, const void *buf, uint32_t len, uint32_t flags) {
+
+  if ((flags & ~IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Send does not block in the VSocket peripheral
+  return iotSocketSend(socket, buf, len);
+}
+
+// Update time budget with the time elapsed since start (in kernel ticks)
+static void timeout_update (uint32_t start, uint32_t *timeout) {
+  uint32_t elapsed;
+
+  elapsed = (uint32_t)(((uint64_t)(osKernelGetTickCount() - start) * 1000U) / osKernelGetTickFreq());
+  *timeout = (elapsed < *timeout) ? (*timeout - elapsed) : 0U;
+}
+
+// Accept a new connection on a socket within a time budget
+int32_t iotSocketAcceptTimed (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port, uint32_t *timeout) {
+  volatile vSocketAcceptIO_t io;
+  uint32_t start;
+
+  if ((socket < 0) || (socket >= NUM_SOCKS) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  io.param.socket  = socket;
+  io.param.ip      = ip;
+  io.param.ip_len  = ip_len;
+  io.param.port    = port;
+  __DSB();
+
+  // Simulate a blocking call, limited by the time budget
+  start = osKernelGetTickCount();
+  for (;;) {
+    ARM_VSOCKET->vSocketAcceptIO = &io;
+    __DSB();
+    timeout_update(start, timeout);
+    if (io.ret_val != IOT_SOCKET_EAGAIN) {
+      break;
+    }
+    if (*timeout == 0U) {
+      io.ret_val = IOT_SOCKET_ETIMEDOUT;
+      break;
+    }
+    start = osKernelGetTickCount();
+    osDelay(10U);
+  }
+  if (io.ret_val >= 0) {
+    sock_attr[io.ret_val].ionbio  = sock_attr[socket].ionbio;
+    sock_attr[io.ret_val].to_msec = sock_attr[socket].to_msec;
+  }
+
+  return io.ret_val;
+}
+
+// Connect a socket to a remote host within a time budget
+int32_t iotSocketConnectTimed (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port, uint32_t *timeout) {
+  volatile vSocketConnectIO_t io;
+  uint32_t start;
+
+  if ((socket < 0) || (socket >= NUM_SOCKS) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  io.param.socket  = socket;
+  io.param.ip      = ip;
+  io.param.ip_len  = ip_len;
+  io.param.port    = port;
+  __DSB();
+
+  // Simulate a blocking call, limited by the time budget
+  start = osKernelGetTickCount();
+  for (;;) {
+    ARM_VSOCKET->vSocketConnectIO = &io;
+    __DSB();
+    timeout_update(start, timeout);
+    if ((io.ret_val != IOT_SOCKET_EINPROGRESS) && (io.ret_val != IOT_SOCKET_EALREADY)) {
+      break;
+    }
+    if (*timeout == 0U) {
+      io.ret_val = IOT_SOCKET_ETIMEDOUT;
+      break;
+    }
+    start = osKernelGetTickCount();
+    osDelay(10U);
+  }
+  if (io.ret_val == IOT_SOCKET_EISCONN) {
+    return 0;
+  }
+
+  return io.ret_val;
+}
+
+// Receive data on a connected socket within a time budget
+int32_t iotSocketRecvTimed (int32_t socket, void *buf, uint32_t len, uint32_t *timeout) {
+  volatile vSocketRecvIO_t io;
+  uint32_t start;
+
+  if ((socket < 0) || (socket >= NUM_SOCKS)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((buf == NULL) || (len == 0U) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  io.param.socket = socket;
+  io.param.buf    = buf;
+  io.param.len    = len;
+  __DSB();
+
+  // Simulate a blocking call, limited by the time budget
+  start = osKernelGetTickCount();
+  for (;;) {
+    ARM_VSOCKET->vSocketRecvIO = &io;
+    __DSB();
+    timeout_update(start, timeout);
+    if (io.ret_val == 0) {
+      io.ret_val = IOT_SOCKET_EAGAIN;
+    }
+    if (io.ret_val != IOT_SOCKET_EAGAIN) {
+      break;
+    }
+    if (*timeout == 0U) {
+      io.ret_val = IOT_SOCKET_ETIMEDOUT;
+      break;
+    }
+    start = osKernelGetTickCount();
+    osDelay(10U);
+  }
+
+  return io.ret_val;
+}
+
+// Send data on a connected socket within a time budget
+int32_t iotSocketSendTimed (int32_t socket, const void *buf, uint32_t len, uint32_t *timeout) {
+
+  if ((buf == NULL) || (len == 0U) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Send does not block in the VSocket peripheral
+  return iotSocketSend(socket, buf, len);
+}
+
+// Receive data on a socket together with its receive timestamp
+int32_t iotSocketRecvFromTs (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port, iotSocketTimestamp_t *ts) {
+  (void)socket;
+  (void)buf;
+  (void)len;
+  (void)ip;
+  (void)ip_len;
+  (void)port;
+  (void)ts;
+
+  // VSocket peripheral has no timestamp interface
+  return IOT_SOCKET_ENOTSUP;
+}
+
 // Retrieve local IP address and port of a socket
 int32_t iotSocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
   volatile vSocketGetSockNameIO_t io;
@@ -325,6 +540,27 @@ int32_t iotSocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, uint32_t
     case IOT_SOCKET_SO_TYPE:
       // Get from FVP host
       break;
+    case IOT_SOCKET_SO_BROADCAST:
+    case IOT_SOCKET_IP_TOS:
+    case IOT_SOCKET_SO_PRIORITY:
+    case IOT_SOCKET_TCP_NODELAY:
+    case IOT_SOCKET_TCP_CORK:
+    case IOT_SOCKET_SO_RCVBUF:
+    case IOT_SOCKET_SO_SNDBUF:
+    case IOT_SOCKET_TCP_KEEPIDLE:
+    case IOT_SOCKET_TCP_KEEPINTVL:
+    case IOT_SOCKET_TCP_KEEPCNT:
+    case IOT_SOCKET_IP_MULTICAST_TTL:
+    case IOT_SOCKET_IP_MULTICAST_LOOP:
+    case IOT_SOCKET_IPV6_MULTICAST_HOPS:
+    case IOT_SOCKET_IPV6_MULTICAST_LOOP:
+    case IOT_SOCKET_SO_LINGER:
+    case IOT_SOCKET_SO_REUSEADDR:
+    case IOT_SOCKET_IO_FIONREAD:
+    case IOT_SOCKET_SO_TIMESTAMP:
+    case IOT_SOCKET_SO_TIMESTAMP_TX:
+      // Not implemented by the FVP host
+      return IOT_SOCKET_ENOTSUP;
     default:
       return IOT_SOCKET_EINVAL;
   }
@@ -364,6 +600,30 @@ int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, ui
     case IOT_SOCKET_SO_KEEPALIVE:
       // Set in FVP host
       break;
+    case IOT_SOCKET_SO_BROADCAST:
+    case IOT_SOCKET_IP_TOS:
+    case IOT_SOCKET_SO_PRIORITY:
+    case IOT_SOCKET_TCP_NODELAY:
+    case IOT_SOCKET_TCP_CORK:
+    case IOT_SOCKET_SO_RCVBUF:
+    case IOT_SOCKET_SO_SNDBUF:
+    case IOT_SOCKET_TCP_WINDOW:
+    case IOT_SOCKET_TCP_KEEPIDLE:
+    case IOT_SOCKET_TCP_KEEPINTVL:
+    case IOT_SOCKET_TCP_KEEPCNT:
+    case IOT_SOCKET_IP_ADD_MEMBERSHIP:
+    case IOT_SOCKET_IP_DROP_MEMBERSHIP:
+    case IOT_SOCKET_IP_MULTICAST_TTL:
+    case IOT_SOCKET_IP_MULTICAST_LOOP:
+    case IOT_SOCKET_IPV6_JOIN_GROUP:
+    case IOT_SOCKET_IPV6_LEAVE_GROUP:
+    case IOT_SOCKET_IPV6_MULTICAST_HOPS:
+    case IOT_SOCKET_IPV6_MULTICAST_LOOP:
+    case IOT_SOCKET_SO_LINGER:
+    case IOT_SOCKET_SO_REUSEADDR:
+    case IOT_SOCKET_SO_TIMESTAMP:
+      // Not implemented by the FVP host
+      return IOT_SOCKET_ENOTSUP;
     default:
       return IOT_SOCKET_EINVAL;
   }
@@ -380,6 +640,20 @@ int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, ui
   return io.ret_val;
 }
 
+// Shut down part or all of a full-duplex connection
+int32_t iotSocketShutdown (int32_t socket, int32_t how) {
+
+  if ((socket < 0) || (socket >= NUM_SOCKS)) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((how != IOT_SOCKET_SHUT_RD) && (how != IOT_SOCKET_SHUT_WR) && (how != IOT_SOCKET_SHUT_RDWR)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // VSocket peripheral has no shutdown interface
+  return IOT_SOCKET_ENOTSUP;
+}
+
 // Close and release a socket
 int32_t iotSocketClose (int32_t socket) {
   volatile vSocketCloseIO_t io;
@@ -421,3 +695,60 @@ int32_t iotSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint3
 
   return io.ret_val;
 }
+
+// Retrieve all host IP addresses from host name
+int32_t iotSocketGetAddrInfo (const char *name, int32_t af, iotSocketAddr_t *addrs, uint32_t *count, uint32_t *ttls) {
+  int32_t  family[2];
+  uint32_t num_family, num, i;
+  int32_t  rc;
+
+  if ((name == NULL) || (addrs == NULL) || (count == NULL) || (*count == 0U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  switch (af) {
+    case IOT_SOCKET_AF_UNSPEC:
+      family[0]  = IOT_SOCKET_AF_INET6;
+      family[1]  = IOT_SOCKET_AF_INET;
+      num_family = 2U;
+      break;
+    case IOT_SOCKET_AF_INET:
+    case IOT_SOCKET_AF_INET6:
+      family[0]  = af;
+      num_family = 1U;
+      break;
+    default:
+      return IOT_SOCKET_EINVAL;
+  }
+
+  // VSocket host returns one address per address family
+  num = 0U;
+  rc  = IOT_SOCKET_EHOSTNOTFOUND;
+  for (i = 0U; (i < num_family) && (num < *count); i++) {
+    addrs[num].ip_len = sizeof(addrs[num].ip);
+    rc = iotSocketGetHostByName(name, family[i], addrs[num].ip, &addrs[num].ip_len);
+    if (rc == 0) {
+      if (ttls != NULL) {
+        ttls[num] = 0U;
+      }
+      num++;
+    }
+  }
+
+  if (num == 0U) {
+    return rc;
+  }
+  *count = num;
+
+  return 0;
+}
+
+// Retrieve directed broadcast address of the local network
+int32_t iotSocketGetBroadcastAddr (uint8_t *ip, uint32_t *ip_len) {
+
+  if ((ip == NULL) || (ip_len == NULL) || (*ip_len < 4U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Network configuration of the FVP host is not available
+  return IOT_SOCKET_ENOTSUP;
+}
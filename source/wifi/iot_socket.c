@@ -72,6 +72,118 @@ int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const ui
   return ptrWiFi->SocketSendTo(socket, buf, len, ip, ip_len, port);
 }
 
+// Receive data on a connected socket with message flags
+int32_t iotSocketRecvEx (int32_t socket, void *buf, uint32_t len, uint32_t flags) {
+  int32_t  type     = IOT_SOCKET_SOCK_STREAM;
+  uint32_t type_len = sizeof(type);
+  uint32_t num;
+  int32_t  rc;
+
+  if ((flags & ~(IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_DONTWAIT | IOT_SOCKET_MSG_WAITALL | IOT_SOCKET_MSG_TRUNC)) != 0U) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((flags & (IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_DONTWAIT | IOT_SOCKET_MSG_TRUNC)) != 0U) {
+    // Flags not defined by the WiFi driver
+    return IOT_SOCKET_ENOTSUP;
+  }
+  if ((flags & IOT_SOCKET_MSG_WAITALL) != 0U) {
+    rc = ptrWiFi->SocketGetOpt(socket, IOT_SOCKET_SO_TYPE, &type, &type_len);
+    if (rc < 0) {
+      return rc;
+    }
+  }
+
+  num = 0U;
+  do {
+    rc = ptrWiFi->SocketRecv(socket, (uint8_t *)buf + num, len - num);
+    if (rc <= 0) {
+      break;
+    }
+    num += (uint32_t)rc;
+  } while ((type == IOT_SOCKET_SOCK_STREAM) && ((flags & IOT_SOCKET_MSG_WAITALL) != 0U) && (num < len));
+
+  if (num != 0U) {
+    // Return received data, error is reported on the next call
+    return (int32_t)num;
+  }
+
+  return rc;
+}
+
+// Send data on a connected socket with message flags
+int32_t iotSocketSendEx (int32_t socket, const void *buf, uint32_t len, uint32_t flags) {
+
+  if ((flags & ~IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((flags & IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+    // Flag not defined by the WiFi driver
+    return IOT_SOCKET_ENOTSUP;
+  }
+
+  return ptrWiFi->SocketSend(socket, buf, len);
+}
+
+// Accept a new connection on a socket within a time budget
+int32_t iotSocketAcceptTimed (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port, uint32_t *timeout) {
+  (void)socket;
+  (void)ip;
+  (void)ip_len;
+  (void)port;
+  (void)timeout;
+
+  // WiFi driver supports only per-socket timeouts
+  return IOT_SOCKET_ENOTSUP;
+}
+
+// Connect a socket to a remote host within a time budget
+int32_t iotSocketConnectTimed (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port, uint32_t *timeout) {
+  (void)socket;
+  (void)ip;
+  (void)ip_len;
+  (void)port;
+  (void)timeout;
+
+  // WiFi driver supports only per-socket timeouts
+  return IOT_SOCKET_ENOTSUP;
+}
+
+// Receive data on a connected socket within a time budget
+int32_t iotSocketRecvTimed (int32_t socket, void *buf, uint32_t len, uint32_t *timeout) {
+  (void)socket;
+  (void)buf;
+  (void)len;
+  (void)timeout;
+
+  // WiFi driver supports only per-socket timeouts
+  return IOT_SOCKET_ENOTSUP;
+}
+
+// Send data on a connected socket within a time budget
+int32_t iotSocketSendTimed (int32_t socket, const void *buf, uint32_t len, uint32_t *timeout) {
+  (void)socket;
+  (void)buf;
+  (void)len;
+  (void)timeout;
+
+  // WiFi driver supports only per-socket timeouts
+  return IOT_SOCKET_ENOTSUP;
+}
+
+// Receive data on a socket together with its receive timestamp
+int32_t iotSocketRecvFromTs (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port, iotSocketTimestamp_t *ts) {
+  (void)socket;
+  (void)buf;
+  (void)len;
+  (void)ip;
+  (void)ip_len;
+  (void)port;
+  (void)ts;
+
+  // WiFi driver does not report the receive time
+  return IOT_SOCKET_ENOTSUP;
+}
+
 // Retrieve local IP address and port of a socket
 int32_t iotSocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
   return ptrWiFi->SocketGetSockName(socket, ip, ip_len, port);
@@ -84,14 +196,31 @@ int32_t iotSocketGetPeerName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uin
 
 // Get socket option
 int32_t iotSocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val, uint32_t *opt_len) {
+  if (opt_id > IOT_SOCKET_SO_TYPE) {
+    // Option not defined by the WiFi driver
+    return IOT_SOCKET_ENOTSUP;
+  }
   return ptrWiFi->SocketGetOpt(socket, opt_id, opt_val, opt_len);
 }
 
 // Set socket option
 int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, uint32_t opt_len) {
+  if (opt_id > IOT_SOCKET_SO_TYPE) {
+    // Option not defined by the WiFi driver
+    return IOT_SOCKET_ENOTSUP;
+  }
   return ptrWiFi->SocketSetOpt(socket, opt_id, opt_val, opt_len);
 }
 
+// Shut down part or all of a full-duplex connection
+int32_t iotSocketShutdown (int32_t socket, int32_t how) {
+  (void)socket;
+  (void)how;
+
+  // Function not defined by the WiFi driver
+  return IOT_SOCKET_ENOTSUP;
+}
+
 // Close and release a socket
 int32_t iotSocketClose (int32_t socket) {
   return ptrWiFi->SocketClose(socket);
@@ -101,3 +230,79 @@ int32_t iotSocketClose (int32_t socket) {
 int32_t iotSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len) {
   return ptrWiFi->SocketGetHostByName (name, af, ip, ip_len);
 }
+
+// Retrieve all host IP addresses from host name
+int32_t iotSocketGetAddrInfo (const char *name, int32_t af, iotSocketAddr_t *addrs, uint32_t *count, uint32_t *ttls) {
+  int32_t  family[2];
+  uint32_t num_family, num, i;
+  int32_t  rc;
+
+  if ((name == NULL) || (addrs == NULL) || (count == NULL) || (*count == 0U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  switch (af) {
+    case IOT_SOCKET_AF_UNSPEC:
+      family[0]  = IOT_SOCKET_AF_INET6;
+      family[1]  = IOT_SOCKET_AF_INET;
+      num_family = 2U;
+      break;
+    case IOT_SOCKET_AF_INET:
+    case IOT_SOCKET_AF_INET6:
+      family[0]  = af;
+      num_family = 1U;
+      break;
+    default:
+      return IOT_SOCKET_EINVAL;
+  }
+
+  // WiFi driver returns one address per address family
+  num = 0U;
+  rc  = IOT_SOCKET_EHOSTNOTFOUND;
+  for (i = 0U; (i < num_family) && (num < *count); i++) {
+    addrs[num].ip_len = sizeof(addrs[num].ip);
+    rc = ptrWiFi->SocketGetHostByName(name, family[i], addrs[num].ip, &addrs[num].ip_len);
+    if (rc == 0) {
+      if (ttls != NULL) {
+        ttls[num] = 0U;
+      }
+      num++;
+    }
+  }
+
+  if (num == 0U) {
+    return rc;
+  }
+  *count = num;
+
+  return 0;
+}
+
+// Retrieve directed broadcast address of the local network
+int32_t iotSocketGetBroadcastAddr (uint8_t *ip, uint32_t *ip_len) {
+  uint8_t  addr[4], mask[4];
+  uint32_t len, i;
+
+  if ((ip == NULL) || (ip_len == NULL) || (*ip_len < 4U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Station interface configuration
+  len = sizeof(addr);
+  if (ptrWiFi->GetOption(0U, ARM_WIFI_IP, addr, &len) != ARM_DRIVER_OK) {
+    return IOT_SOCKET_ERROR;
+  }
+  len = sizeof(mask);
+  if (ptrWiFi->GetOption(0U, ARM_WIFI_IP_SUBNET_MASK, mask, &len) != ARM_DRIVER_OK) {
+    return IOT_SOCKET_ERROR;
+  }
+  if ((addr[0] | addr[1] | addr[2] | addr[3]) == 0U) {
+    // Interface not configured
+    return IOT_SOCKET_ENOTCONN;
+  }
+  for (i = 0U; i < 4U; i++) {
+    ip[i] = addr[i] | (uint8_t)~mask[i];
+  }
+  *ip_len = 4U;
+
+  return 0;
+}
@@ -34,7 +34,7 @@ int32_t iotSocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint1
   if (socket < 0) {
     return IOT_SOCKET_ESOCK;
   }
-  if ((ip == NULL) || (port == 0)) {
+  if (ip == NULL) {
     return IOT_SOCKET_EINVAL;
   }
 
@@ -177,6 +177,132 @@ int32_t iotSocketSendTo (int32_t socket, const void *buf, uint32_t len, const ui
   return IOT_SOCKET_ERROR;
 }
 
+// Receive data on a connected socket with message flags
+int32_t iotSocketRecvEx (int32_t socket, void *buf, uint32_t len, uint32_t flags) {
+
+  // Check parameters
+  if (socket < 0) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((flags & ~(IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_DONTWAIT | IOT_SOCKET_MSG_WAITALL | IOT_SOCKET_MSG_TRUNC)) != 0U) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((flags & (IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_WAITALL)) == (IOT_SOCKET_MSG_PEEK | IOT_SOCKET_MSG_WAITALL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((buf == NULL) && (len != 0U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Add implementation
+  // return 0;
+  return IOT_SOCKET_ERROR;
+}
+
+// Send data on a connected socket with message flags
+int32_t iotSocketSendEx (int32_t socket, const void *buf, uint32_t len, uint32_t flags) {
+
+  // Check parameters
+  if (socket < 0) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((flags & ~IOT_SOCKET_MSG_DONTWAIT) != 0U) {
+    return IOT_SOCKET_EINVAL;
+  }
+  if ((buf == NULL) && (len != 0U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Add implementation
+  // return 0;
+  return IOT_SOCKET_ERROR;
+}
+
+// Accept a new connection on a socket within a time budget
+int32_t iotSocketAcceptTimed (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port, uint32_t *timeout) {
+
+  // Check parameters
+  if (socket < 0) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if (timeout == NULL) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Add implementation
+  // Wait at most *timeout ms and store the time left in *timeout
+  // return socket_id;
+  return IOT_SOCKET_ERROR;
+}
+
+// Connect a socket to a remote host within a time budget
+int32_t iotSocketConnectTimed (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port, uint32_t *timeout) {
+
+  // Check parameters
+  if (socket < 0) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((ip == NULL) || (port == 0) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Add implementation
+  // Wait at most *timeout ms and store the time left in *timeout
+  // return 0;
+  return IOT_SOCKET_ERROR;
+}
+
+// Receive data on a connected socket within a time budget
+int32_t iotSocketRecvTimed (int32_t socket, void *buf, uint32_t len, uint32_t *timeout) {
+
+  // Check parameters
+  if (socket < 0) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((buf == NULL) || (len == 0U) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Add implementation
+  // Wait at most *timeout ms and store the time left in *timeout
+  // return num_of_bytes_received;
+  return IOT_SOCKET_ERROR;
+}
+
+// Send data on a connected socket within a time budget
+int32_t iotSocketSendTimed (int32_t socket, const void *buf, uint32_t len, uint32_t *timeout) {
+
+  // Check parameters
+  if (socket < 0) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((buf == NULL) || (len == 0U) || (timeout == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Add implementation
+  // Wait at most *timeout ms and store the time left in *timeout
+  // return num_of_bytes_sent;
+  return IOT_SOCKET_ERROR;
+}
+
+// Receive data on a socket together with its receive timestamp
+int32_t iotSocketRecvFromTs (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port, iotSocketTimestamp_t *ts) {
+
+  // Check parameters
+  if (socket < 0) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((buf == NULL) || (len == 0U) || (ts == NULL)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Add implementation
+  // Return timestamp of the received datagram in *ts
+  // return num_of_bytes_received;
+  return IOT_SOCKET_ERROR;
+}
+
 // Retrieve local IP address and port of a socket
 int32_t iotSocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port) {
 
@@ -235,6 +361,22 @@ int32_t iotSocketSetOpt (int32_t socket, int32_t opt_id, const void *opt_val, ui
   return IOT_SOCKET_ERROR;
 }
 
+// Shut down part or all of a full-duplex connection
+int32_t iotSocketShutdown (int32_t socket, int32_t how) {
+
+  // Check parameters
+  if (socket < 0) {
+    return IOT_SOCKET_ESOCK;
+  }
+  if ((how != IOT_SOCKET_SHUT_RD) && (how != IOT_SOCKET_SHUT_WR) && (how != IOT_SOCKET_SHUT_RDWR)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Add implementation
+  // return 0;
+  return IOT_SOCKET_ERROR;
+}
+
 // Close and release a socket
 int32_t iotSocketClose (int32_t socket) {
 
@@ -261,3 +403,29 @@ int32_t iotSocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint3
   // return 0;
   return IOT_SOCKET_ERROR;
 }
+
+// Retrieve all host IP addresses from host name
+int32_t iotSocketGetAddrInfo (const char *name, int32_t af, iotSocketAddr_t *addrs, uint32_t *count, uint32_t *ttls) {
+
+  // Check parameters
+  if ((name == NULL) || (addrs == NULL) || (count == NULL) || (*count == 0U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Add implementation (set 'ttls' entries to 0 when the record lifetime is not known)
+  // return 0;
+  return IOT_SOCKET_ERROR;
+}
+
+// Retrieve directed broadcast address of the local network
+int32_t iotSocketGetBroadcastAddr (uint8_t *ip, uint32_t *ip_len) {
+
+  // Check parameters
+  if ((ip == NULL) || (ip_len == NULL) || (*ip_len < 4U)) {
+    return IOT_SOCKET_EINVAL;
+  }
+
+  // Add implementation
+  // return 0;
+  return IOT_SOCKET_ERROR;
+}